@@ -47,6 +47,8 @@ MEMORY
     BOOT_RSVD (RX)  : origin = 0x20004000, length = 0x0900
     C2 (RWX)        : origin = 0x20004900, length = 0x1700
     C3 (RWX)        : origin = 0x20006000, length = 0x2000
+    /* S0, S1 and S5..S7 are M3-owned (ping-pong blocks and SCI port
+       instances, see self/ipc_block.h); S2..S4 are left to the C28 */
     S0 (RWX)        : origin = 0x20008000, length = 0x2000
     S1 (RWX)        : origin = 0x2000A000, length = 0x2000
     S2 (RWX)        : origin = 0x2000C000, length = 0x2000
@@ -99,11 +101,16 @@ SECTIONS
         GETREADIDX  
     }
 
+    /* M3 to C28 message ring, see self/ipc_ring.h */
+    MTOCRING    : > MTOCRAM
+
     GROUP : > CTOMRAM 
     {
         GETBUFFER : TYPE = DSECT
         GETWRITEIDX : TYPE = DSECT
         PUTREADIDX : TYPE = DSECT
+        /* C28 runtime snapshot, see self/ipc_snap.h */
+        CTOMSNAP : TYPE = DSECT
     }    
 }
 
@@ -125,11 +125,16 @@ SECTIONS
         GETREADIDX  
     }
 
+    /* M3 to C28 message ring, see self/ipc_ring.h */
+    MTOCRING    : > MTOCRAM
+
      GROUP : > CTOMRAM 
     {
         GETBUFFER : TYPE = DSECT
         GETWRITEIDX : TYPE = DSECT
         PUTREADIDX : TYPE = DSECT
+        /* C28 runtime snapshot, see self/ipc_snap.h */
+        CTOMSNAP : TYPE = DSECT
     }    
 }
 
@@ -96,6 +96,11 @@ SECTIONS
                            crc_table(AppCrc, algorithm=CRC32_PRIME),
                            PAGE = 0
 
+    /* Shared SARAM owned by the M3 (made M3 master at startup), the C28
+       linker file must not place anything in these blocks:
+         S0, S1  M3-to-C28 ping-pong blocks, see self/ipc_block.h
+         S5..S7  SCI port instances, see self/sci_port.h
+       S2..S4 are left to the C28. */
     SHARERAMS0  : > S0
     SHARERAMS1  : > S1
     SHARERAMS2  : > S2
@@ -113,11 +118,16 @@ SECTIONS
         GETREADIDX  
     }
 
+    /* M3 to C28 message ring, see self/ipc_ring.h */
+    MTOCRING    : > MTOCRAM
+
     GROUP : > CTOMRAM 
     {
         GETBUFFER : TYPE = DSECT
         GETWRITEIDX : TYPE = DSECT
         PUTREADIDX : TYPE = DSECT
+        /* C28 runtime snapshot, see self/ipc_snap.h */
+        CTOMSNAP : TYPE = DSECT
     }    
 }
 
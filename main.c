@@ -23,11 +23,18 @@
 #include "uart.h"
 #include "flash.h"
 #include "cpu.h"
+#include "systick.h"
 
 #include "ram.h"
 #include <string.h>
 #include "message.h"
+#include "crc.h"
 #include "global_var.h"
+#include "sci_port.h"
+#include "ipc_ring.h"
+#include "ipc_sync.h"
+#include "ipc_snap.h"
+#include "ipc_block.h"
 
 //*****************************************************************************
 //
@@ -68,9 +75,6 @@ main(void)
 
     // Define Local  Variables
     unsigned short counter;
-    unsigned short *pusMBufferPt;
-    unsigned short *pusCBufferPt;
-    unsigned long *pulMsgRam;
 
     // Disable Protection
     HWREG(SYSCTL_MWRALLOW) =  0xA5A5A5A5;
@@ -81,14 +85,14 @@ main(void)
                          SYSCTL_XCLKDIV_4);
 
     // Initialize M3toC28 message RAM and Sx SARAM and wait until initialized
-    RAMMReqSharedMemAccess(S0_ACCESS, SX_M3MASTER);
-    //RAMMReqSharedMemAccess(S1_ACCESS, SX_M3MASTER);
+    //S0S1ΪM3C28ƹݿ飬ʼM3أC28ֻвлMSxMSEL
+    RAMMReqSharedMemAccess(S0_ACCESS | S1_ACCESS, SX_M3MASTER);
 
     //
     // Initialize Sx RAM and MtoC MSG RAM Used by Example
     //
-    HWREG(RAM_CONFIG_BASE + RAM_O_MSXRTESTINIT1) |= 0x1;
-    while((HWREG(RAM_CONFIG_BASE + RAM_O_MSXRINITDONE1)&0x1) != 0x1)
+    HWREG(RAM_CONFIG_BASE + RAM_O_MSXRTESTINIT1) |= 0x5;
+    while((HWREG(RAM_CONFIG_BASE + RAM_O_MSXRINITDONE1)&0x5) != 0x5)
     {
     }
 
@@ -132,15 +136,14 @@ main(void)
 
 
 
-    pulMsgRam = (void *)M3_MTOC_PASSMSG;
-    pulMsgRam[2]= (unsigned long)&gusMBuffer[0];
+    //вC28˳˫շCTOM MSG RAM(self/ipc_snap.h)
+    //дgusMBufferMTOC_PASSMSG[2]ٴַ
 
+    //дMTOC MSG RAMеϢλC28ַMTOC_PASSMSG[3]
+    IpcRingInit();
 
-    // Initialize local variables
-    pulMsgRam = (void *)M3_CTOM_PASSMSG;
-
-    pusMBufferPt = (void *)M3_S0SARAM_START;
-    pusCBufferPt = (void *)(M3_S0SARAM_START + usMBuffer_SIZE);
+    //ȫòS0/S1ʱطIPC־(self/ipc_block.h)
+    IpcBlockInit();
 
     ErrorCount = 0;
 
@@ -167,7 +170,6 @@ main(void)
 
 
     // Enable clock supply for the peripherals
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART1);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOC);
@@ -193,122 +195,50 @@ main(void)
     IntMasterEnable();
 
 
-    // Set GPIO D2 and D3 as UART pins.
-    GPIOPinConfigure(GPIO_PD2_U1RX);
-    GPIOPinConfigure(GPIO_PD3_U1TX);
-    GPIOPinTypeUART(GPIO_PORTD_BASE, GPIO_PIN_2 | GPIO_PIN_3);
+    //1msʱͨѶЭ鳬ʱ
+    SysTickPeriodSet(SysCtlClockGet(SYSTEM_CLOCK_SPEED) / 1000);
+    SysTickIntRegister(SysTickIntHandler);
+    SysTickIntEnable();
+    SysTickEnable();
+
+    SciCmdInit();
+    CrcInit();
 
-    // Configure the UART for 9600, 8-N-1 operation.
-    UARTConfigSetExpClk(UART1_BASE, SysCtlClockGet(SYSTEM_CLOCK_SPEED), 9600,
-                        (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
-                         UART_CONFIG_PAR_NONE));
+    //Ӧ֡uDMAֽͣuDMAƹһ
+    SciDmaInit();
 
-    // Enable the UART interrupt.
-    IntRegister(INT_UART1, UARTIntHandler);
-    IntEnable(INT_UART1);
-    UARTIntEnable(UART1_BASE, UART_INT_RX | UART_INT_RT);
+    //ÿUARTһͨѶʵ(UART0UART1RS485շƣUART2ΪModbus RTUվ)
+    //ʼΪ96008-N-1λòЭл߲
+    SciPortInit();
 
 
 
     // Loop forever while the timers run.
     while(1)
     {
-        if(IPC_get_flag)
-        {
-            IPCdata_tran();
-            IPC_get_flag=0;
-        }
-        //ͨѶ봦
-         Checkdata();
-         SciSend();
+        //C28µвʱParametȴC28
+        IPCdata_tran();
+        //ͨѶ봦˿
+         SciPortProcess();
 
-         if(IPC_send_flag==1)
+         //C28֡ڻλʱusMBufferУ˴ԣȴC28
+         if((IPC_send_flag==1) && IpcRingPut(usMBuffer, usMBuffer[0]))
          {
-             // Data Block Writes
-             // Request Memory Access to S0 SARAM for M3
-             RAMMReqSharedMemAccess (S0_ACCESS, SX_M3MASTER);
-             while ((HWREG(RAM_CONFIG_BASE + RAM_O_MSXMSEL) & S0_ACCESS) != 0)
-             {
-             }
-             // Write a block of data from M3 to S0 shared RAM which is then written to a
-             // C28 address.
-             for (counter = 0; counter < usMBuffer_SIZE; counter++)
-             {
-                 pusMBufferPt[counter] = usMBuffer[counter];
-             }
-
-             IPCMtoCBlockWrite(&g_sIpcController2, pulMsgRam[2],
-                               (unsigned long)pusMBufferPt, usMBuffer_SIZE, IPC_LENGTH_16_BITS,
-                               ENABLE_BLOCKING);
-
-             // Give Memory Access to S0 SARAM to C28
-             RAMMReqSharedMemAccess (S0_ACCESS, SX_C28MASTER);
-
-             while ((HWREG(RAM_CONFIG_BASE + RAM_O_MSXMSEL) & S0_ACCESS) != S0_ACCESS)
-             {
-             }
-
-             // Read data back from C28.
-             IPCMtoCBlockRead(&g_sIpcController2, pulMsgRam[2],
-                              (unsigned long)pusCBufferPt, usMBuffer_SIZE, ENABLE_BLOCKING,
-                              IPC_FLAG17);
-
-             // Wait until read data is ready (by checking IPC Response Flag is cleared).
-             // Then check for correct data.
-             while (HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & IPC_MTOCIPCFLG_IPC17)
-             {
-             }
-
-             for (counter = 0; counter <usMBuffer_SIZE; counter++)
-             {
-                 if (usMBuffer[counter] != pusCBufferPt[counter])
-                 {
-                     ErrorFlag = 1;
-                 }
-                 else
-                 {
-                     ErrorFlag = 0;
-                 }
-             }
-
-             if (ErrorFlag == 1)
-             {
-                 ErrorCount++;
-             }
-
              IPC_send_flag=0;
          }
+         //дĲͶʱطò
+         IpcSyncProcess();
 
     }
-}
+}
 
 
 //*****************************************************************************
-// The UART interrupt handler.
+//SysTickжϴ1msʱ
 //*****************************************************************************
-void UARTIntHandler(void)
+void SysTickIntHandler(void)
 {
-    unsigned long ulStatus;
-
-    // Get the interrupt status.
-    ulStatus = UARTIntStatus(UART1_BASE, true);
-
-
-//    //get the charôָ
-//    u=UARTCharGet(UART1_BASE);
-
-    SciRecieve();
-
-    // Clear the asserted interrupts.
-    UARTIntClear(UART1_BASE, ulStatus);
-
-//    // Loop while there are characters in the receive FIFO.
-//    while(UARTCharsAvail(UART1_BASE))
-//    {
-//        // Read the next character from the UART and write it back to the UART.
-//        UARTCharPutNonBlocking(UART1_BASE,
-//                               UARTCharGetNonBlocking(UART1_BASE));
-//    }
+    g_ulTickMs++;
 }
 
 //*****************************************************************************
@@ -397,7 +327,6 @@ CtoMIPC2IntHandler (void)
             break;
         }
     }
-    IPC_get_flag=1;
     // Acknowledge IPC INT2 Flag
     HWREG(MTOCIPC_BASE + IPC_O_CTOMIPCACK) |= IPC_CTOMIPCACK_IPC2;
 }
@@ -406,11 +335,22 @@ void IPCdata_tran(void)
 {
     int i=0;
 
-    for(i=0;i<44;i++)
+    //һµĿոƵgusMBufferC28ڼд˿ʱض
+    if(!IpcSnapRead(gusMBuffer))
+    {
+        return;
+    }
+    for(i=0;i<RunParamNumber;i++)
     {
         IPC_get.bit.MEM1=gusMBuffer[2*i];
         IPC_get.bit.MEM2=gusMBuffer[2*i+1];
-        Paramet[i]=IPC_get.all;
+        //ֻб仯˵ĲɶӦ𻺴֡ǷҪϱ
+        if(Paramet[i]!=IPC_get.all)
+        {
+            Paramet[i]=IPC_get.all;
+            SciCacheUpdate(i);
+            SciReportUpdate(i);
+        }
     }
 
 }
@@ -0,0 +1,112 @@
+/*
+ *     cobs.c
+ *
+ *     COBSֽڱ룬Э޹أλϱʹ
+ *
+ *
+ */
+
+#include "cobs.h"
+
+//ʼµһ֡дpucBuf
+void CobsDecoderInit(tCobsDecoder *psDec, uint8_t *pucBuf, uint32_t ulSize)
+{
+    psDec->pucBuf = pucBuf;
+    psDec->ulSize = ulSize;
+    psDec->ulLength = 0;
+    psDec->ucLeft = 0;
+    psDec->ucZero = 0;
+    psDec->ucError = 0;
+    psDec->ucStart = 0;
+}
+
+static void CobsDecodePut(tCobsDecoder *psDec, uint8_t ucData)
+{
+    if(psDec->ulLength >= psDec->ulSize)
+    {
+        psDec->ucError = 1;
+        return;
+    }
+    psDec->pucBuf[psDec->ulLength++] = ucData;
+}
+
+//һֽڣCOBS_FRAMECOBS_ERRORµCobsDecoderInit()
+uint32_t CobsDecodeByte(tCobsDecoder *psDec, uint8_t ucData)
+{
+    if(ucData == COBS_DELIMITER)
+    {
+        if(!psDec->ucStart)
+        {
+            return(COBS_MORE);//ķָ
+        }
+        //ֿδָ˵֡ضϣһ0x00
+        if(psDec->ucError || psDec->ucLeft)
+        {
+            return(COBS_ERROR);
+        }
+        return(COBS_FRAME);
+    }
+
+    psDec->ucStart = 1;
+    if(psDec->ucLeft == 0)//ֿ
+    {
+        if(psDec->ucZero)
+        {
+            CobsDecodePut(psDec, 0);
+        }
+        psDec->ucLeft = ucData - 1;
+        psDec->ucZero = (ucData != 0xFF);
+    }
+    else
+    {
+        CobsDecodePut(psDec, ucData);
+        psDec->ucLeft--;
+    }
+    return(COBS_MORE);
+}
+
+void CobsEncoderInit(tCobsEncoder *psEnc, uint8_t *pucOut)
+{
+    psEnc->pucOut = pucOut;
+    psEnc->ulCode = 0;
+    psEnc->ulLength = 1;
+    psEnc->ucRun = 1;
+}
+
+//һֽڣֿڷֿʱ
+void CobsEncodeByte(tCobsEncoder *psEnc, uint8_t ucData)
+{
+    if(ucData != 0)
+    {
+        psEnc->pucOut[psEnc->ulLength++] = ucData;
+        psEnc->ucRun++;
+        if(psEnc->ucRun != 0xFF)
+        {
+            return;
+        }
+    }
+    psEnc->pucOut[psEnc->ulCode] = psEnc->ucRun;
+    psEnc->ulCode = psEnc->ulLength++;
+    psEnc->ucRun = 1;
+}
+
+//һ֡ķֿ벢ӷָرֽ
+uint32_t CobsEncodeEnd(tCobsEncoder *psEnc)
+{
+    psEnc->pucOut[psEnc->ulCode] = psEnc->ucRun;
+    psEnc->pucOut[psEnc->ulLength++] = COBS_DELIMITER;
+    return(psEnc->ulLength);
+}
+
+//룬رָֽ
+uint32_t CobsEncode(const uint8_t *pucIn, uint32_t ulCount, uint8_t *pucOut)
+{
+    tCobsEncoder sEnc;
+
+    CobsEncoderInit(&sEnc, pucOut);
+    while(ulCount--)
+    {
+        CobsEncodeByte(&sEnc, *pucIn++);
+    }
+    return(CobsEncodeEnd(&sEnc));
+}
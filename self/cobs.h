@@ -0,0 +1,46 @@
+#ifndef __COBS_H__
+#define __COBS_H__
+
+//----------------------------------COBSֽ
+//֡ݾCOBS󲻺0x00֡βһ0x00ΪָյָΪһ֡
+//һָȻͬÿ254ֽ1ֽڿ
+//ΪֽڽУֻ׼ͷļ̼λɹ
+#include <stdint.h>
+
+#define COBS_DELIMITER 0x00
+#define COBS_MORE  0   //֡δ
+#define COBS_FRAME 1   //յһ֡ȼulLength
+#define COBS_ERROR 2   //֡ضϻ򳬳Ѷ
+
+//󳤶ȣݳ+ֿ+ָ
+#define COBS_ENCODED_MAX(n) ((n) + ((n) / 254) + 2)
+
+typedef struct
+{
+    uint8_t *pucBuf;    //
+    uint32_t ulSize;    //
+    uint32_t ulLength;  //ѽֽ
+    uint8_t ucLeft;     //ǰֿʣֽ0ʾһֽΪֿ
+    uint8_t ucZero;     //ǰֿ0x00
+    uint8_t ucError;    //֡ѳȴָ
+    uint8_t ucStart;    //֡յֽ
+} tCobsDecoder;
+
+typedef struct
+{
+    uint8_t *pucOut;    //
+    uint32_t ulCode;    //ǰֿλ
+    uint32_t ulLength;  //ֽ
+    uint8_t ucRun;      //ǰֵֿ
+} tCobsEncoder;
+
+extern void CobsDecoderInit(tCobsDecoder *psDec, uint8_t *pucBuf, uint32_t ulSize);
+extern uint32_t CobsDecodeByte(tCobsDecoder *psDec, uint8_t ucData);
+
+//ʼλñǰ1+n/254ֽʱԭر루nΪݳȣ
+extern void CobsEncoderInit(tCobsEncoder *psEnc, uint8_t *pucOut);
+extern void CobsEncodeByte(tCobsEncoder *psEnc, uint8_t ucData);
+extern uint32_t CobsEncodeEnd(tCobsEncoder *psEnc);
+extern uint32_t CobsEncode(const uint8_t *pucIn, uint32_t ulCount, uint8_t *pucOut);
+
+#endif
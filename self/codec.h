@@ -0,0 +1,65 @@
+#ifndef __CODEC_H__
+#define __CODEC_H__
+
+//----------------------------------֡ݱ
+//ֽڶдСݣֱuint8_t֡棨uDMAͻ棩вλ
+//ֻ׼ͷļx86 LinuxϱԪ
+#include <stdint.h>
+#include <string.h>
+
+static inline void CodecPutU16(uint8_t *pucData, uint16_t usValue)
+{
+    pucData[0] = (uint8_t)usValue;
+    pucData[1] = (uint8_t)(usValue >> 8);
+}
+
+static inline void CodecPutU32(uint8_t *pucData, uint32_t ulValue)
+{
+    pucData[0] = (uint8_t)ulValue;
+    pucData[1] = (uint8_t)(ulValue >> 8);
+    pucData[2] = (uint8_t)(ulValue >> 16);
+    pucData[3] = (uint8_t)(ulValue >> 24);
+}
+
+static inline uint16_t CodecGetU16(const uint8_t *pucData)
+{
+    return((uint16_t)(pucData[0] | ((uint16_t)pucData[1] << 8)));
+}
+
+static inline uint32_t CodecGetU32(const uint8_t *pucData)
+{
+    return((uint32_t)pucData[0] | ((uint32_t)pucData[1] << 8) |
+           ((uint32_t)pucData[2] << 16) | ((uint32_t)pucData[3] << 24));
+}
+
+//ModbusĴΪˣֽǰ
+static inline void CodecPutU16Be(uint8_t *pucData, uint16_t usValue)
+{
+    pucData[0] = (uint8_t)(usValue >> 8);
+    pucData[1] = (uint8_t)usValue;
+}
+
+static inline uint16_t CodecGetU16Be(const uint8_t *pucData)
+{
+    return((uint16_t)(((uint16_t)pucData[0] << 8) | pucData[1]));
+}
+
+//floatIEEE754λʹ䣬memcpy˫
+static inline void CodecPutFloat(uint8_t *pucData, float fValue)
+{
+    uint32_t ulValue;
+
+    memcpy(&ulValue, &fValue, sizeof(ulValue));
+    CodecPutU32(pucData, ulValue);
+}
+
+static inline float CodecGetFloat(const uint8_t *pucData)
+{
+    uint32_t ulValue = CodecGetU32(pucData);
+    float fValue;
+
+    memcpy(&fValue, &ulValue, sizeof(fValue));
+    return(fValue);
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ *     crc.c
+ *
+ *     ֡У飺CRCֽڣʱֽۼӣuCRCӲCRCɿ飬ʱʹã
+ *
+ *
+ */
+
+#include "crc.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "ucrc.h"
+
+//ֽڲÿֽڲΣFlash
+static const unsigned short g_pusCrc16Table[16] =
+{
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static const unsigned long g_pulCrc32Table[16] =
+{
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD
+};
+
+static const unsigned short g_pusCrcModbusTable[16] =
+{
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+    0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+
+unsigned long g_ulCrcHw = 0;
+
+//Լ"123456789"ı׼
+#define CRC16_CHECK 0x31C3
+#define CRC32_CHECK 0x89A1897F
+
+//uCRCɿ
+static unsigned long CrcHw(unsigned long ulMode, const unsigned char *pucData,
+                           unsigned long ulCount)
+{
+    unsigned long ulType;
+
+    ulType = (ulMode == CRC_MODE_16) ? UCRC_CONFIG_CRC16_2 : UCRC_CONFIG_CRC32;
+    UCRCClear(UCRC_BASE);
+    UCRCConfig(UCRC_BASE, ulType);
+    return(UCRCCalculation(UCRC_BASE, ulType,
+                           (unsigned char *)UCRC_REMAP_ADDRESS(pucData),
+                           ulCount));
+}
+
+//ñ׼ݱȶӲһʱȫʹCRC
+void CrcInit(void)
+{
+    static const unsigned char pucCheck[9] =
+    {
+        '1', '2', '3', '4', '5', '6', '7', '8', '9'
+    };
+
+    g_ulCrcHw = (CrcHw(CRC_MODE_16, pucCheck, 9) == CRC16_CHECK) &&
+                (CrcHw(CRC_MODE_32, pucCheck, 9) == CRC32_CHECK);
+}
+
+//֡βУֽ
+unsigned int CrcLength(unsigned long ulMode)
+{
+    return((ulMode == CRC_MODE_SUM) ? 1 : ((ulMode == CRC_MODE_16) ? 2 : 4));
+}
+
+//CRCۼһֽ
+unsigned long CrcUpdate(unsigned long ulMode, unsigned long ulCrc,
+                        unsigned char ucData)
+{
+    if(ulMode == CRC_MODE_16)
+    {
+        ulCrc = (ulCrc << 4) ^ g_pusCrc16Table[((ulCrc >> 12) ^ (ucData >> 4)) & 0xF];
+        ulCrc = (ulCrc << 4) ^ g_pusCrc16Table[((ulCrc >> 12) ^ ucData) & 0xF];
+        return(ulCrc & 0xFFFF);
+    }
+    ulCrc = ((ulCrc << 4) & 0xFFFFFFFF) ^ g_pulCrc32Table[((ulCrc >> 28) ^ (ucData >> 4)) & 0xF];
+    ulCrc = (ulCrc << 4) ^ g_pulCrc32Table[((ulCrc >> 28) ^ ucData) & 0xF];
+    return(ulCrc & 0xFFFFFFFF);
+}
+
+unsigned long CrcSoft(unsigned long ulMode, const unsigned char *pucData,
+                      unsigned long ulCount)
+{
+    unsigned long ulCrc = 0;
+
+    while(ulCount--)
+    {
+        ulCrc = CrcUpdate(ulMode, ulCrc, *pucData++);
+    }
+    return(ulCrc);
+}
+
+//ɿ㣬ʹuCRC
+unsigned long CrcBlock(unsigned long ulMode, const unsigned char *pucData,
+                       unsigned long ulCount)
+{
+    if(g_ulCrcHw)
+    {
+        return(CrcHw(ulMode, pucData, ulCount));
+    }
+    return(CrcSoft(ulMode, pucData, ulCount));
+}
+
+//Modbus RTU֡У飬Լ"123456789"ĽΪ0x4B37
+unsigned int CrcModbus(const unsigned char *pucData, unsigned long ulCount)
+{
+    unsigned int uiCrc = 0xFFFF;
+
+    while(ulCount--)
+    {
+        uiCrc ^= *pucData++;
+        uiCrc = (uiCrc >> 4) ^ g_pusCrcModbusTable[uiCrc & 0xF];
+        uiCrc = (uiCrc >> 4) ^ g_pusCrcModbusTable[uiCrc & 0xF];
+    }
+    return(uiCrc);
+}
@@ -0,0 +1,24 @@
+#ifndef __CRC_H__
+#define __CRC_H__
+
+//----------------------------------֡У鷽ʽ
+//CRC16ʽ0x1021ֵ0λǰuCRCCRC16-P2ͬ
+//CRC32ʽ0x04C11DB7ֵ0λǰuCRCCRC32ͬתͽ
+#define CRC_MODE_SUM 0   //8λУ飨ȡ1ԭзʽ
+#define CRC_MODE_16  1   //CRC16ֽǰ֡β
+#define CRC_MODE_32  2   //CRC32ֽǰ֡β
+//Modbus RTUʽ0x8005λת㣨0xA001ֵ0xFFFFֽǰ֡βuCRCַ֧תֻ
+
+extern unsigned long g_ulCrcHw;  //1:uCRCԼͨɿʹӲ
+
+extern void CrcInit(void);
+extern unsigned int CrcLength(unsigned long ulMode);
+extern unsigned long CrcUpdate(unsigned long ulMode, unsigned long ulCrc,
+                               unsigned char ucData);
+extern unsigned long CrcSoft(unsigned long ulMode, const unsigned char *pucData,
+                             unsigned long ulCount);
+extern unsigned long CrcBlock(unsigned long ulMode, const unsigned char *pucData,
+                              unsigned long ulCount);
+extern unsigned int CrcModbus(const unsigned char *pucData, unsigned long ulCount);
+
+#endif
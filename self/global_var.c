@@ -10,30 +10,23 @@
 //sci
 unsigned int Switchsystem;
 unsigned int RCBUF[24];//RS485 ջ ϵͳͨѶЭ24ݣ
-unsigned int ReciveRCOUNT;//RS485 ռ 0~11
-unsigned int RC_DataCount;   //ݼ
-unsigned int TXCOUNT=0;//RS485 ͼ
 unsigned int PSOCOUNT=0;//RS485 ͼ
-unsigned int TXBUF[13];//RS485 ͻ
-unsigned int PSOBUF[PSONumber];//RS485 ͻ
+unsigned char PSOBUF[PSO_BUF_SIZE];//RS485 ͻ
 unsigned int flagRC=0;//ݽ־λ
-unsigned int flagSEND=0;//ݱ־λ
 unsigned int PSOSENDF=0;//ݱ־λ
 //unsigned int RunCommand_L;
 //unsigned int RunCommand_H;
 unsigned int RunCommand;
 unsigned int cyclecount;
-unsigned int datasum;//
 unsigned int datasum1;
 unsigned int PackLength;     //ݰ
-unsigned int RC_DataBUF[20];  //ݻվ-к--ݸ-ݵ-У룩
-unsigned int RC_DataCount;   //ݼ
-unsigned int SortNumber;     //վ
+unsigned int g_uiSciTxn=SCI_TXN_NONE;//ǰ
+unsigned int g_uiSciStation=SCI_STATION_NONE;//ǰվ
+unsigned char *RC_DataBUF;  //ǰݣк---У룩ָ˿еĶ
 unsigned int SerialNumber;   //SCI
 unsigned int CommandCode;     //SCI
 unsigned int CheckCode;      //У
 unsigned int SendData;       //
-unsigned int SendDataNumber;     //ݸ
 //unsigned int Paramet[ParameterNumber];
 unsigned int PSO_datainit_flag;
 float Paramet[ParameterNumber];
@@ -43,15 +36,10 @@ float pso_t[10];
 int n_pso=0;
 
 unsigned int IPC_send_flag=0;
-unsigned int IPC_get_flag=0;
-union FLOAT_COM  Data_get;
-union FLOAT_COMF  FData_send;
-union FLOAT_COMF  FData_get;
-union FLOAT_COMF  PSO_send;
-union FLOAT_COMF  PSO_get;
 union FLOAT_IPCF  IPC_get;
 
 float PSO_g[4]={0,0,0,0};
+volatile unsigned long g_ulTickMs=0;//SysTick
 
 //IPC
 //*****************************************************************************
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "message.h"
+#include "sci_ring.h"
 #include "ipc.h"
 
 //Ƕһ#define   һextern float
@@ -15,13 +16,59 @@
 //#define TestIO PORTBbits.RB5  //ڼ
 //#define CL485 PORTBbits.RB13  //CL485Ϊ1ʱʹܣΪ0ʱʹ
 #define ParameterNumber 118 //ͨű
-
-
-#define SortNo 0x01//վţδʹ
-//#define set485 GpioDataRegs.GPASET.bit.GPIO26= 1//ʹ
-//#define clear485 GpioDataRegs.GPACLEAR.bit.GPIO26= 1 //ʹ
+#define RunParamNumber 44   //C28ϴʵʱвParamet[0..43]
+#define SCI_PACK_MIN 3     //̰к++У
+#define SCI_RXDATA_MAX 96  //հޣRC_DataBUFȣܷ֡usMBufferתC28
+#define SCI_CMD_ANY 0xFFFF //бʾ룬ƥ
+#define SCI_LEN_ANY 0      //бʾɱ䣬ɴ
+//չ֡FE FE FE FE / 00 / ־ /  /  / [վ] / [] / к /  /  / У
+//ֽΪ0ʾչ֡Ϊ־ֽں16λУͰ־վ
+//־SCI_FLAG_TXNλʱ1ֽţӦ֡ԭأƥӦ
+//־SCI_FLAG_STATIONλʱ1ֽվţRS485ͨѶsci_station.h
+#define SCI_LONG_FRAME 0x00  //չ֡־
+#define SCI_FLAG_TXN 0x01    //չ֡־λ
+#define SCI_FLAG_STATION 0x02 //չ֡־λվ
+#define SCI_FLAG_MASK (SCI_FLAG_TXN | SCI_FLAG_STATION) //Ѷı־λλλ֡
+#define SCI_HEAD_END 10      //ǰĽռͨ֡İֽںֱ˴
+#define SCI_LONG_HEAD 8      //չ֡ͷȣվźţ
+#define SCI_TXN_NONE 0xFFFF  //󲻴
+#define SCI_STATION_BROADCAST 0xFF //㲥վţ㲥֡Ӧ
+#define SCI_STATION_NONE 0xFFFF    //󲻴վ
+//֡ʽĬΪFEͷ+ЭΪCOBS루cobs.hʡȥͷͰڷָͬ
+//ҲЭΪModbus RTUmodbus.h˿ڴ˺ΪModbusվٴЭ֡
+#define SCI_FRAMING_FE 0
+#define SCI_FRAMING_COBS 1
+#define SCI_FRAMING_MODBUS 2
+#define SCI_REQ_WINDOW 4     //յδޣ2
+#define SCI_TXBUF_SIZE 512   //Ͷÿ泤ȣȫӦ
+#define SCI_PARAM_MAP_BYTES ((ParameterNumber+7)/8) //λͼֽ
+//Э̣ԭӦлʱδյȷݰָԭ
+#define SCI_BAUD_DEFAULT 9600   //ϵĬϲ
+#define SCI_BAUD_MIN 1200       //Э̵Ͳ
+#define SCI_BAUD_TIMEOUT 2000   //лȴЧݰʱ䣬ms
+#define SCI_BAUD_IDLE 0         //״̬ȶ
+#define SCI_BAUD_PENDING 1      //Ӧ𣬵ȴӦϺл
+#define SCI_BAUD_TRIAL 2        //лȴ²ʷЧݰ
+
+
+#define SortNo 0x01//ϵĬվţվ޸
 #define On_off 81   //ػ
+#define On_off_Code 0xB1 //ػ
 #define ConfirmCode  01 //SCIȷ
+#define RejectCode  00 //SCI룬Ƿ
+#define BulkRead_Code 0xC1    //ʼ+
+#define BulkReadMap_Code 0xC2 //λͼ
+#define BulkWrite_Code 0xC3    //дʼ++ֵ
+#define BulkWriteMap_Code 0xC4 //д++ֵ
+#define Baud_Code 0xC5         //Э̣32λʣֽǰ
+#define StreamSub_Code 0xC6    //
+#define Stream_Code 0xC7       //֡M3ͣ
+#define Crc_Code 0xC8          //У鷽ʽЭ̣0У 1 CRC16 2 CRC32
+#define Stats_Code 0xC9        //ȡͨѶͳ
+#define Station_Code 0xCA      //ñվ
+#define Framing_Code 0xCB      //֡ʽЭ̣0ͷ+ 1 COBS 2 Modbus RTU
+#define ReportSub_Code 0xCC    //ʵʱв仯ϱ
+#define Report_Code 0xCD       //仯ϱ֡M3ͣ
 //ԶSCIӦϵ
 #define speed_bldcm 1
 #define I_meandc_run 2
@@ -107,36 +154,38 @@
 #define flux_psm 105
 
 
+//յȴ
+typedef struct
+{
+    const tSciCmd *psCmd;         //Ӧ
+    unsigned int uiLength;        //ΪУ鷽ʽ
+    unsigned int uiTxn;           //ţSCI_TXN_NONEʾ
+    unsigned int uiStation;       //վţSCI_STATION_NONEʾ
+    unsigned char pucData[SCI_RXDATA_MAX]; //к---У
+} tSciReq;
+
 #define graphNumber 400
-#define PSONumber 48
+#define PSONumber 48 //PSO֡У飩CRC32Уʱ֡β3ֽ
+#define PSO_BUF_SIZE (PSONumber + 3)
 
 
 extern unsigned int Switchsystem;
 extern unsigned int RCBUF[24];//RS485 ջ ϵͳͨѶЭ25ݣ
-extern unsigned int ReciveRCOUNT;//RS485 ռ 0~25
-extern unsigned int RC_DataCount;   //ݼ
-extern unsigned int TXCOUNT;//RS485 ͼ
 extern unsigned int PSOCOUNT;//RS485 ͼ
-extern unsigned int TXBUF[13];//RS485 ͻ
-extern unsigned int PSOBUF[PSONumber];//RS485 ͻ
+extern unsigned char PSOBUF[PSO_BUF_SIZE];//RS485 ͻ
 extern unsigned int flagRC;//ݽ־λ
-extern unsigned int flagSEND;//ݱ־λ
 extern unsigned int PSOSENDF;//ݱ־λ
 extern unsigned int RunCommand_L;
 extern unsigned int RunCommand_H;
 extern unsigned int RunCommand;
 extern unsigned int cyclecount;
-extern unsigned int datasum;//
 extern unsigned int datasum1;
 extern unsigned int PackLength;     //ݰ
-extern unsigned int RC_DataBUF[20];  //ݻվ-к--ݸ-ݵ-У룩
-extern unsigned int RC_DataCount;   //ݼ
-extern unsigned int SortNumber;     //վ
+extern unsigned char *RC_DataBUF;  //ǰݣк---У룩
 extern unsigned int SerialNumber;   //SCI
 extern unsigned int CommandCode;     //SCI
 extern unsigned int CheckCode;      //У
 extern unsigned int SendData;       //
-extern unsigned int SendDataNumber;     //ݸ
 //extern unsigned int Paramet[ParameterNumber];
 extern unsigned int PSO_datainit_flag;
 extern float Paramet[ParameterNumber];
@@ -146,14 +195,11 @@ extern int n_pso;
 
 
 extern unsigned int IPC_send_flag;
-extern unsigned int IPC_get_flag;
-extern union FLOAT_COM  Data_get;
-extern union FLOAT_COMF  FData_send;
-extern union FLOAT_COMF  FData_get;
-extern union FLOAT_COMF  PSO_send;
-extern union FLOAT_COMF  PSO_get;
 extern union FLOAT_IPCF  IPC_get;
 extern float PSO_g[4];
+extern volatile unsigned long g_ulTickMs;//SysTick
+extern unsigned int g_uiSciTxn;//ǰ
+extern unsigned int g_uiSciStation;//ǰվ
 
 
 //IPC
@@ -173,7 +219,7 @@ extern float PSO_g[4];
 #define usMBuffer_SIZE 100 //IPCͨѶ
 
 extern unsigned short usMBuffer[usMBuffer_SIZE];
-extern unsigned short gusMBuffer[usMBuffer_SIZE];
+extern unsigned short gusMBuffer[usMBuffer_SIZE]; //C28вյM3
 //*****************************************************************************
 // At least 1 volatile global tIpcController instance is required when using
 // IPC API Drivers.
@@ -0,0 +1,73 @@
+/*
+ *     ipc_block.c
+ *
+ *     M3C28ƹһS0S1C28ÿȨɸԵIPC־лٵȴMSxMSEL
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "ipc_block.h"
+#include "hw_types.h"
+#include "hw_memmap.h"
+#include "hw_ipc.h"
+
+//ֱS0S1ʼC28ԼĵַӳֱӶȡ
+#if defined(ccs)
+#pragma DATA_SECTION(g_sIpcBlock0, "SHARERAMS0")
+#pragma DATA_SECTION(g_sIpcBlock1, "SHARERAMS1")
+static tIpcBlock g_sIpcBlock0;
+static tIpcBlock g_sIpcBlock1;
+#else
+static tIpcBlock g_sIpcBlock0 __attribute__ ((section("SHARERAMS0")));
+static tIpcBlock g_sIpcBlock1 __attribute__ ((section("SHARERAMS1")));
+#endif
+
+static tIpcBlock *const g_ppsIpcBlock[2] = { &g_sIpcBlock0, &g_sIpcBlock1 };
+static const unsigned long g_pulIpcBlockFlag[2] = { IPC_BLOCK_FLAG0, IPC_BLOCK_FLAG1 };
+static unsigned short g_usIpcBlockSeq; //ѽĿһΪg_ppsIpcBlock[g_usIpcBlockSeq&1]
+
+//S0S1ΪM3ʼ֮ڵȴC28(IPC17)֮ǰ
+void IpcBlockInit(void)
+{
+    g_usIpcBlockSeq = 0;
+    g_sIpcBlock0.usSeq = 0;
+    g_sIpcBlock0.usCount = 0;
+    g_sIpcBlock1.usSeq = 0;
+    g_sIpcBlock1.usCount = 0;
+}
+
+//һԹC28鶼ѽҶδ꣩ʱд
+unsigned long IpcBlockBusy(void)
+{
+    return(HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) &
+           g_pulIpcBlockFlag[g_usIpcBlockSeq & 1]);
+}
+
+//нĿC28δ
+unsigned long IpcBlockPending(void)
+{
+    return(HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & IPC_BLOCK_FLAGS);
+}
+
+//һĵulOffsetִдϢݣ÷IpcBlockBusy()ȷһM3C28ֻһ
+void IpcBlockWrite(unsigned long ulOffset, unsigned short usData)
+{
+    g_ppsIpcBlock[g_usIpcBlockSeq & 1]->pusData[ulOffset] = usData;
+}
+
+//дulCountֵһ齻C28һԹC28ʱ0÷´
+unsigned long IpcBlockSend(unsigned long ulCount)
+{
+    unsigned long ulBlock = g_usIpcBlockSeq & 1;
+    tIpcBlock *psBlock = g_ppsIpcBlock[ulBlock];
+
+    if(IpcBlockBusy())
+    {
+        return(0);
+    }
+    psBlock->usCount = ulCount;
+    psBlock->usSeq = ++g_usIpcBlockSeq;
+    HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCSET) = g_pulIpcBlockFlag[ulBlock];
+    return(1);
+}
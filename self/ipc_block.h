@@ -0,0 +1,31 @@
+#ifndef __IPC_BLOCK_H__
+#define __IPC_BLOCK_H__
+
+//----------------------------------M3C28ĹRAMƹһ
+//S0S1һ飬ʱһΪM3C28ΪԶвлMSxMSEL˫ȴȨ
+//߼ϵȨÿһIPC־־λʱC28ӵһ飬C28Ӧ()־һصM3
+//ϸһS0usSeqΪһC28ʱM3ճдһ鲢鶼C28ʱŵȴ
+//鶼ѽʱC28usSeqСһȻصM3һ
+//ΪϢʽ뻷λͬusCountΪϢ
+//C28ȴĿ飬ȡ֮뻷λϢIpcSyncProcess()ڻλΪʱ
+//RAMķ䣨M3C28ԼS0S1ΪƹһS5~S7ΪSCI˿ʵsci_port.h
+//ʱΪM3C28зݣS2~S4δʹãC28
+#define IPC_BLOCK_WORDS 1024        //ÿ
+#define IPC_BLOCK_FLAG0 IPC_FLAG3   //S0C28MTOCIPC3ж
+#define IPC_BLOCK_FLAG1 IPC_FLAG4   //S1C28MTOCIPC4ж
+#define IPC_BLOCK_FLAGS (IPC_BLOCK_FLAG0 | IPC_BLOCK_FLAG1)
+
+typedef struct
+{
+    volatile unsigned short usSeq;    //M3
+    volatile unsigned short usCount;  //Ϣ
+    volatile unsigned short pusData[IPC_BLOCK_WORDS];
+} tIpcBlock;
+
+extern void IpcBlockInit(void);
+extern unsigned long IpcBlockBusy(void);
+extern unsigned long IpcBlockPending(void);
+extern void IpcBlockWrite(unsigned long ulOffset, unsigned short usData);
+extern unsigned long IpcBlockSend(unsigned long ulCount);
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ *     ipc_ring.c
+ *
+ *     M3C28Ϣλ޸ֱдMTOCϢRAMռS0ȴC28
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "ipc_ring.h"
+#include "hw_types.h"
+
+//MTOCϢRAM
+#if defined(ccs)
+#pragma DATA_SECTION(g_sIpcRing, "MTOCRING")
+static tIpcRing g_sIpcRing;
+#else
+static tIpcRing g_sIpcRing __attribute__ ((section("MTOCRING")));
+#endif
+
+unsigned long g_ulIpcRingFull = 0;
+
+//ڵȴC28(IPC17)֮ǰãC28ݴҵ
+void IpcRingInit(void)
+{
+    unsigned long *pulMsgRam = (void *)M3_MTOC_PASSMSG;
+
+    g_sIpcRing.usWrite = 0;
+    pulMsgRam[3] = (unsigned long)&g_sIpcRing;
+}
+
+//
+unsigned long IpcRingFree(void)
+{
+    return(IPC_RING_SIZE -
+           (unsigned short)(g_sIpcRing.usWrite - HWREGH(M3_CTOM_RINGREAD)));
+}
+
+//д֮ulOffsetִдϢݣIpcRingCommit()֮ǰC28
+//÷IpcRingFree()ȷ㹻Ŀռ
+void IpcRingWrite(unsigned long ulOffset, unsigned short usData)
+{
+    g_sIpcRing.pusBuf[(g_sIpcRing.usWrite + ulOffset) & IPC_RING_MASK] = usData;
+}
+
+//дulCount֣дϢٷдC28дʱϢһѾЧ
+void IpcRingCommit(unsigned long ulCount)
+{
+    g_sIpcRing.usWrite += ulCount;
+}
+
+//һϢӣѭеãŲʱ0÷´
+unsigned long IpcRingPut(const unsigned short *pusMsg, unsigned long ulCount)
+{
+    unsigned long i;
+
+    if(IpcRingFree() < ulCount)
+    {
+        g_ulIpcRingFull++;
+        return(0);
+    }
+    for(i = 0; i < ulCount; i++)
+    {
+        IpcRingWrite(i, pusMsg[i]);
+    }
+    IpcRingCommit(ulCount);
+    return(1);
+}
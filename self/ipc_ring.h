@@ -0,0 +1,34 @@
+#ifndef __IPC_RING_H__
+#define __IPC_RING_H__
+
+//----------------------------------M3C28Ϣλ
+//(M3ѭ)/(C28)ȡS0дٶУ
+//дMTOCϢRAMУֻM3дCTOMϢRAMУֻC28д
+//˫Ҫ빲RAMȨM3ӲȴC28
+//Ϊ16λɼC28һζдɣֵΪе
+//ϢʽԭusMBufferͬһΪLL-1Ϊкš롢ݣÿһֽڣ
+//ϢL֣Կĩβ±갴IPC_RING_MASKƣ
+//C28(IPC17)ǰѶ㣻ѭждʱȡһϢӶ
+//M3ѻĵַдMTOC_PASSMSG[3]C28ϢRAMĵַӳ任ΪԼĵַ
+#define IPC_RING_SIZE 512   //ȣ֣Ϊ2
+#define IPC_RING_MASK (IPC_RING_SIZE-1)
+
+//C28ĶCTOM_PASSMSG[3]ĵ16λ
+#define M3_CTOM_RINGREAD (M3_CTOM_PASSMSG + 12)
+
+typedef struct
+{
+    volatile unsigned short usWrite;   //дM3
+    unsigned short usReserved;
+    volatile unsigned short pusBuf[IPC_RING_SIZE];
+} tIpcRing;
+
+extern unsigned long g_ulIpcRingFull; //ϢƳӵĴ
+
+extern void IpcRingInit(void);
+extern unsigned long IpcRingFree(void);
+extern void IpcRingWrite(unsigned long ulOffset, unsigned short usData);
+extern void IpcRingCommit(unsigned long ulCount);
+extern unsigned long IpcRingPut(const unsigned short *pusMsg, unsigned long ulCount);
+
+#endif
@@ -0,0 +1,52 @@
+/*
+ *     ipc_snap.c
+ *
+ *     C28вգ˫ӷM3һʱضC28ȴ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "ipc_snap.h"
+
+//CTOMϢRAMУC28д룬M3洢
+#if defined(ccs)
+#pragma DATA_SECTION(g_sIpcSnap, "CTOMSNAP")
+static tIpcSnap g_sIpcSnap;
+#else
+static tIpcSnap g_sIpcSnap __attribute__ ((section("CTOMSNAP")));
+#endif
+
+unsigned short g_usIpcSnapSeq = 0;
+unsigned long g_ulIpcSnapRetry = 0;
+
+//C28¿ʱƵpusDst1ѭеã
+//û¿աضIPC_SNAP_RETRYԲһʱ0pusDstݲ
+unsigned long IpcSnapRead(unsigned short *pusDst)
+{
+    const volatile unsigned short *pusSrc;
+    unsigned short usSeq;
+    unsigned long ulTry;
+    unsigned long i;
+
+    for(ulTry = 0; ulTry < IPC_SNAP_RETRY; ulTry++)
+    {
+        usSeq = g_sIpcSnap.usSeq;
+        if(usSeq == g_usIpcSnapSeq)
+        {
+            return(0);
+        }
+        pusSrc = g_sIpcSnap.pusData[usSeq & 1];
+        for(i = 0; i < IPC_SNAP_WORDS; i++)
+        {
+            pusDst[i] = pusSrc[i];
+        }
+        if(g_sIpcSnap.usSeq == usSeq)
+        {
+            g_usIpcSnapSeq = usSeq;
+            return(1);
+        }
+        g_ulIpcSnapRetry++;
+    }
+    return(0);
+}
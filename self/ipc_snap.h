@@ -0,0 +1,28 @@
+#ifndef __IPC_SNAP_H__
+#define __IPC_SNAP_H__
+
+//----------------------------------C28ϴʵʱв
+//C28RunParamNumberвдCTOMϢRAMе˫16λ˳(seqlock)
+//ȡC28дgusMBufferд;M3¾ɻӵһ
+//C28ÿڣд뻺pusData[(usSeq+1)&1]M3ʱһ飩дusSeq1C28ӲȴM3
+//M3usSeqpusData[usSeq&1]ٶusSeqδŲãض
+//ڼC28ֻܸдһ飬ҪβŻصڸƵһ飬һθusSeq伴һ
+//ÿ֣ԭgusMBufferͬ16λǰ
+//driverlibIPCһη(TYPE = DSECT)M3CTOMSNAPC28ͬ
+//ڸCTOMRAMеλͬC28λȰusSeq
+#define IPC_SNAP_WORDS (2 * RunParamNumber) //ÿ
+#define IPC_SNAP_RETRY 4        //һζȡضԲһʱ´ѭ
+
+typedef struct
+{
+    volatile unsigned short usSeq;    //C28һΪpusData[usSeq&1]
+    unsigned short usReserved;
+    volatile unsigned short pusData[2][IPC_SNAP_WORDS];
+} tIpcSnap;
+
+extern unsigned short g_usIpcSnapSeq;   //ѲõĿյķң֡λ
+extern unsigned long g_ulIpcSnapRetry;  //ڼC28¿աضĴ
+
+extern unsigned long IpcSnapRead(unsigned short *pusDst);
+
+#endif
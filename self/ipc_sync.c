@@ -0,0 +1,241 @@
+/*
+ *     ipc_sync.c
+ *
+ *     ParametͬдֻѸдĲC28ʱƹһطȫò
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "ipc_ring.h"
+#include "ipc_block.h"
+#include "ipc_sync.h"
+#include "codec.h"
+#include "hw_types.h"
+#include "hw_memmap.h"
+#include "hw_ipc.h"
+
+//д飺һдĲΪһ飬C28ͬһϢпд
+//g_pucIpcGroup[n]ΪParamet[n]ڵţ0ʾûидѭʹãͬʱȴͬ鲻
+static unsigned char g_pucIpcGroup[ParameterNumber];
+static unsigned char g_pucIpcGroupSize[256]; //Ĳ
+static unsigned char g_ucIpcGroupNow = 1;    //ڱǵ
+static unsigned long g_ulIpcSyncNext;    //´طʱ̣ms
+unsigned long g_ulIpcLiteSent = 0;
+unsigned long g_ulIpcLarge = 0;
+
+//Ѹдȴͬ뵱ǰ
+//δľʱ鲢뵱ǰ飺ֵֻ
+void IpcSyncMark(unsigned int uiIndex)
+{
+    unsigned char ucGroup = g_pucIpcGroup[uiIndex];
+    unsigned int i;
+
+    if(ucGroup == g_ucIpcGroupNow)
+    {
+        return;
+    }
+    if(ucGroup == 0)
+    {
+        g_pucIpcGroup[uiIndex] = g_ucIpcGroupNow;
+        g_pucIpcGroupSize[g_ucIpcGroupNow]++;
+        return;
+    }
+    for(i = 0; i < ParameterNumber; i++)
+    {
+        if(g_pucIpcGroup[i] == ucGroup)
+        {
+            g_pucIpcGroup[i] = g_ucIpcGroupNow;
+        }
+    }
+    g_pucIpcGroupSize[g_ucIpcGroupNow] += g_pucIpcGroupSize[ucGroup];
+    g_pucIpcGroupSize[ucGroup] = 0;
+}
+
+//һĸдϣԺıǼµ
+static void IpcSyncGroupClose(void)
+{
+    if(g_pucIpcGroupSize[g_ucIpcGroupNow] == 0)
+    {
+        return;
+    }
+    do
+    {
+        g_ucIpcGroupNow++;
+    } while((g_ucIpcGroupNow == 0) || g_pucIpcGroupSize[g_ucIpcGroupNow]);
+}
+
+//ȫòдƹһһ齻C28ÿϢIPC_SYNC_RECORD_MAX¼
+//ֻڻλΪաIPC-LiteʱɣC28ȴһ飬ǰϢѴ֮꣬Ϣ
+//һδʱճɣ鶼C28ʱ´
+static unsigned long IpcSyncResync(void)
+{
+    unsigned char pucValue[4];
+    unsigned long ulBase;
+    unsigned long ulOffset;
+    unsigned int uiCount;
+    unsigned int i;
+
+    if(IpcBlockBusy() || (IpcRingFree() != IPC_RING_SIZE) ||
+       (HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & (IPC_LITE_FLAG | IPC_LITE_STATUS)))
+    {
+        return(0);
+    }
+    ulBase = 0;
+    for(i = RunParamNumber; i < ParameterNumber; )
+    {
+        ulOffset = ulBase + 4;
+        for(uiCount = 0; (i < ParameterNumber) && (uiCount < IPC_SYNC_RECORD_MAX); i++, uiCount++)
+        {
+            CodecPutFloat(pucValue, Paramet[i]);
+            IpcBlockWrite(ulOffset++, i);
+            IpcBlockWrite(ulOffset++, pucValue[0]);
+            IpcBlockWrite(ulOffset++, pucValue[1]);
+            IpcBlockWrite(ulOffset++, pucValue[2]);
+            IpcBlockWrite(ulOffset++, pucValue[3]);
+        }
+        IpcBlockWrite(ulBase, ulOffset - ulBase);//
+        IpcBlockWrite(ulBase + 1, 0);//к
+        IpcBlockWrite(ulBase + 2, BulkWriteMap_Code);//
+        IpcBlockWrite(ulBase + 3, uiCount);
+        ulBase = ulOffset;
+    }
+    return(IpcBlockSend(ulBase));
+}
+
+//IPC-LiteдC28ĲC28δṩIPC-Liteæʱ0ûλ
+static unsigned long IpcSyncLite(unsigned int uiIndex)
+{
+    unsigned long ulAddress = HWREG(M3_CTOM_PARAMADDR);
+    unsigned long ulValue;
+
+    //ĿδʱC28ŴеľֵḲIPC-Liteдֵ
+    if((ulAddress == 0) || (IpcRingFree() != IPC_RING_SIZE) || IpcBlockPending())
+    {
+        return(0);
+    }
+    memcpy(&ulValue, &Paramet[uiIndex], sizeof(ulValue));
+    //C2816λֱַÿfloat
+    if(IPCLiteMtoCDataWrite(IPC_LITE_FLAG, ulAddress + 2 * uiIndex, ulValue,
+                            IPC_LENGTH_32_BITS, IPC_LITE_STATUS) != STATUS_PASS)
+    {
+        return(0);
+    }
+    g_ulIpcLiteSent++;
+    return(1);
+}
+
+//ѡһϢ͵飺ȡ飬ŲµһϢؼ¼
+//pucTake[]1ʾѡУIPC_SYNC_RECORD_MAX飨κϲɣѡ*pucLarge
+static unsigned int IpcSyncSelect(unsigned char *pucTake, unsigned char *pucLarge)
+{
+    unsigned int uiCount = 0;
+    unsigned int uiSize;
+    unsigned char ucGroup;
+    unsigned int i;
+
+    memset(pucTake, 0, 256);
+    *pucLarge = 0;
+    for(i = 0; i < ParameterNumber; i++)
+    {
+        ucGroup = g_pucIpcGroup[i];
+        if((ucGroup == 0) || pucTake[ucGroup])
+        {
+            continue;
+        }
+        uiSize = g_pucIpcGroupSize[ucGroup];
+        if(uiSize > IPC_SYNC_RECORD_MAX)
+        {
+            *pucLarge = ucGroup;
+        }
+        else if(uiCount + uiSize <= IPC_SYNC_RECORD_MAX)
+        {
+            pucTake[ucGroup] = 1;
+            uiCount += uiSize;
+        }
+    }
+    return(uiCount);
+}
+
+//ѡедһϢ±4Ϊ¼дϢͷǣϢ*puiIndexΪһ
+static unsigned long IpcSyncBuild(void (*pfnWrite)(unsigned long ulOffset, unsigned short usData),
+                                  const unsigned char *pucTake, unsigned int *puiIndex)
+{
+    unsigned char pucValue[4];
+    unsigned long ulOffset = 4;
+    unsigned int uiCount = 0;
+    unsigned char ucGroup;
+    unsigned int i;
+
+    for(i = 0; i < ParameterNumber; i++)
+    {
+        ucGroup = g_pucIpcGroup[i];
+        if((ucGroup == 0) || !pucTake[ucGroup])
+        {
+            continue;
+        }
+        g_pucIpcGroup[i] = 0;
+        g_pucIpcGroupSize[ucGroup]--;
+        CodecPutFloat(pucValue, Paramet[i]);
+        pfnWrite(ulOffset++, i);
+        pfnWrite(ulOffset++, pucValue[0]);
+        pfnWrite(ulOffset++, pucValue[1]);
+        pfnWrite(ulOffset++, pucValue[2]);
+        pfnWrite(ulOffset++, pucValue[3]);
+        uiCount++;
+        *puiIndex = i;
+    }
+    pfnWrite(0, ulOffset);//У룬Ϣͬ
+    pfnWrite(1, 0);//к
+    pfnWrite(2, BulkWriteMap_Code);//
+    pfnWrite(3, uiCount);
+    return(ulOffset);
+}
+
+//ͬѭCheckdata()еãѱǵĲϳϢֻһʱIPC-Lite
+//Ϣ / к0 / BulkWriteMap_Code /  / ( / ֵ4ֽ)...ÿһֽ
+//һдĲ22һϢŵ¶飻λʱѹ鰴˳װϢ
+//һϢС鲢ܳһϢļ¼ڻλΪʱ
+//ΪһϢдƹһһȫطĿͬ˳
+void IpcSyncProcess(void)
+{
+    static unsigned char pucTake[256];
+    unsigned char ucLarge;
+    unsigned long ulCount;
+    unsigned int uiIndex = 0;
+
+    //طʱ´
+    if(((long)(g_ulTickMs - g_ulIpcSyncNext) >= 0) && IpcSyncResync())
+    {
+        g_ulIpcSyncNext = g_ulTickMs + IPC_SYNC_STEP;
+    }
+    IpcSyncGroupClose();
+
+    //һIPC-LiteдC28֮ǰϢϢ
+    if((HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & (IPC_LITE_FLAG | IPC_LITE_STATUS)) ||
+       (IpcRingFree() < (4 + 5 * IPC_SYNC_RECORD_MAX)))
+    {
+        return;
+    }
+
+    if(IpcSyncSelect(pucTake, &ucLarge) == 0)
+    {
+        if(ucLarge && !IpcBlockBusy() && (IpcRingFree() == IPC_RING_SIZE))
+        {
+            memset(pucTake, 0, sizeof(pucTake));
+            pucTake[ucLarge] = 1;
+            if(IpcBlockSend(IpcSyncBuild(IpcBlockWrite, pucTake, &uiIndex)))
+            {
+                g_ulIpcLarge++;
+            }
+        }
+        return;
+    }
+    //¼ֱд뻷λύ֮ǰC28IPC-LiteʱֱӶ
+    ulCount = IpcSyncBuild(IpcRingWrite, pucTake, &uiIndex);
+    if((ulCount == 4 + 5) && IpcSyncLite(uiIndex))
+    {
+        return;
+    }
+    IpcRingCommit(ulCount);
+}
@@ -0,0 +1,29 @@
+#ifndef __IPC_SYNC_H__
+#define __IPC_SYNC_H__
+
+//----------------------------------ParametͬC28
+//дֻǸдĲ֡תIpcSyncProcess()ѱǵĲ
+//(, ֵ)¼ϳдϢдBulkWriteMap_Code֡ͬ뻷λ
+//дĲȣС޹
+//һдĲΪһ飬ÿϢֻ飬C28ֻһĲָд
+//λʱǱͬһθдֵֻڵľ鲢飩
+//ⰴIPC_SYNC_STEPڰȫòдS0/S1ƹһеһ齻C28ipc_block.h
+//C28©ջλҲָܻһ£طռûλʵʱвC28ϴط
+//ֻдһλеϢѱC28ȫȡߡûнĿʱIPC-LiteֵIPCĴֱдC28Ĳ
+//ϢRAMC28IPC1жмյIPC-LiteδC28ӦʱݲλϢֵ֤Ϣ
+//C28ԼĲ(floatParamet)ĵַдCTOM_PASSMSG[4]Ϊ0ʱֻûλ
+#define IPC_SYNC_RECORD_MAX 50  //һϢļ¼Ϣ4+5n֣λһ
+#define IPC_SYNC_STEP 100       //طڣms
+#define IPC_LITE_FLAG IPC_FLAG1     //IPC-LiteC28MTOCIPC1ж
+#define IPC_LITE_STATUS IPC_FLAG32  //IPC-Lite״̬־
+
+//C28ĵַC28ַCTOM_PASSMSG[4]
+#define M3_CTOM_PARAMADDR (M3_CTOM_PASSMSG + 16)
+
+extern unsigned long g_ulIpcLiteSent; //IPC-LiteĲ
+extern unsigned long g_ulIpcLarge;    //һϢ¼ƹһ
+
+extern void IpcSyncMark(unsigned int uiIndex);
+extern void IpcSyncProcess(void);
+
+#endif
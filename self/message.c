@@ -9,7 +9,13 @@
 #include "global_var.h"
 #include "hw_memmap.h"
 #include "hw_types.h"
+#include "sysctl.h"
 #include "uart.h"
+#include "codec.h"
+#include "crc.h"
+#include "sci_port.h"
+#include "ipc_ring.h"
+#include "ipc_sync.h"
 
 
 
@@ -54,310 +60,1044 @@ void InitSciParameter(void)
     }
 }
 
-//SCIմ
-void SciRecieve(void)
+//ֻڴ˱һ̲ӷ֧
+//ΪSCI_CMD_ANYƥ䣨ԭЭждPSO֡벻̶
+static const tSciCmd g_psSciCmdTable[] =
 {
+    //          У  
+    { On_off_Code,  5,    1,    SciCmdOnOff },  //ػ
+    { SCI_CMD_ANY,  3,    1,    SciCmdRead  },  //
+    { SCI_CMD_ANY,  7,    1,    SciCmdWrite },  //д
+    { SCI_CMD_ANY,  19,   0,    SciCmdPso   },  //Ⱥ0xFFΪУSciPsoMarker()
+    { BulkRead_Code,    5,  1,  SciCmdBulkRead    },  //ʼš
+    { BulkReadMap_Code, 3 + SCI_PARAM_MAP_BYTES, 1, SciCmdBulkReadMap }, //λͼ
+    { BulkWrite_Code,    SCI_LEN_ANY, 1, SciCmdBulkWrite    }, //д
+    { BulkWriteMap_Code, SCI_LEN_ANY, 1, SciCmdBulkWriteMap }, //дɢ
+    { Baud_Code,         7,           1, SciCmdBaud         }, //Э
+    { StreamSub_Code,    SCI_LEN_ANY, 1, SciCmdStream       }, //
+    { Crc_Code,          4,           1, SciCmdCrc          }, //У鷽ʽЭ
+    { Stats_Code,        4,           1, SciCmdStats        }, //ͨѶͳ
+    { Station_Code,      4,           1, SciCmdStation      }, //ñվ
+    { Framing_Code,      4,           1, SciCmdFraming      }, //֡ʽЭ
+    { ReportSub_Code,    13,          1, SciCmdReport       }, //ñ仯ϱ
+};
 
-//DSPd SCIģУʽעĴƵԭһֻܻȡһֽ
-    RCBUF[ReciveRCOUNT++] =UARTCharGet(UART1_BASE); //&0x00FFյİλݣ8λ8λнݣ
-//ǰ4֡ǰͷFE FE FE FE
-    if((ReciveRCOUNT-1)<PackHeadLength)//ͷΪ4ݰͬ
+static const tSciCmd *g_psSciCmdByCode[256];                  //
+static const tSciCmd *g_psSciCmdByLength[SCI_RXDATA_MAX + 1]; //
+
+//ڴUARTжǰ
+void SciCmdInit(void)
+{
+    unsigned int i;
+
+    for(i = 0; i < sizeof(g_psSciCmdTable) / sizeof(g_psSciCmdTable[0]); i++)
     {
-        //Сڰͷȣڽڴ4λͷԶȶİͷFEԱǷͬ
-        if(RCBUF[ReciveRCOUNT-1] != PackHead)//
+        if(g_psSciCmdTable[i].uiCode == SCI_CMD_ANY)
+        {
+            g_psSciCmdByLength[g_psSciCmdTable[i].uiLength] = &g_psSciCmdTable[i];
+        }
+        else
         {
-            //ͬݴ485ռ㣬ֹͣж
-            ReciveRCOUNT = 0;
+            g_psSciCmdByCode[g_psSciCmdTable[i].uiCode] = &g_psSciCmdTable[i];
         }
-        //ͬݴ󣬽νж
     }
-    else if((ReciveRCOUNT-1) == PackHeadLength) //
+}
+
+//SCIմÿδһֽڣSciRxProcess()ѭе
+//֡ʽFE FE FE FE /  / к /  /  / У
+//չ֡FE FE FE FE / 00 / ־ /  /  / [վ] / [] / к /  /  / У
+//վ֡UARTж˳
+//УͣCRCֽڵۼӣһֽڵʱУ
+//CRCʽ֡βУΪ24ֽڣӦӣ֡ΪУ鷽ʽµİ
+//У鷽ʽ
+//ֱдеĿһ֡ӣCheckdata()˳ڼպ
+//ǰ֡ԭʼֽڱڶ˿ڵpucRxRawУ֡ʱӵڶֽѰҰͷ
+//ֽİͷᶪʧ
+#define SCI_RX_MORE 0   //֡δ
+#define SCI_RX_DONE 1   //һ֡
+#define SCI_RX_DROP 2   //ͷУ󣬶֡
+
+static void SciRxCheckByte(tSciPort *psPort, unsigned char ucData)
+{
+    psPort->uiRxSum += ucData;
+    if(psPort->ulCrcMode != CRC_MODE_SUM)
     {
-        //ڰͷȣڰͷѾ
-        PackLength = RCBUF[ReciveRCOUNT-1];//ڶʾİ
-        RC_DataCount = 0;
+        psPort->ulRxCrc = CrcUpdate(psPort->ulCrcMode, psPort->ulRxCrc, ucData);
     }
-    else if((ReciveRCOUNT-1) > PackHeadLength)
+}
+
+static unsigned int SciRxCheckOk(tSciPort *psPort)
+{
+    if(psPort->ulCrcMode == CRC_MODE_SUM)
+    {
+        //ȫݣУ룩֮͵8λΪ0Уȷ
+        return((psPort->uiRxSum & 0x00FF) == 0);
+    }
+    if(psPort->ulCrcMode == CRC_MODE_16)
+    {
+        return(CodecGetU16(&psPort->pucRxBuf[psPort->uiRxLength-2]) == psPort->ulRxCrc);
+    }
+    return(CodecGetU32(&psPort->pucRxBuf[psPort->uiRxLength-4]) == psPort->ulRxCrc);
+}
+
+//루uiLengthΪУԭʼ0
+static const tSciCmd *SciRxLookup(tSciPort *psPort, unsigned char ucCode,
+                                  unsigned int uiLength)
+{
+    const tSciCmd *psCmd;
+
+    psCmd = g_psSciCmdByCode[ucCode];
+    if(psCmd == 0)
+    {
+        psCmd = g_psSciCmdByLength[uiLength - psPort->uiTrailer + 1];
+    }
+    if((psCmd == 0) ||
+       ((psCmd->uiLength != SCI_LEN_ANY) &&
+        ((psCmd->uiLength + psPort->uiTrailer - 1) != uiLength)))
+    {
+        return(0);
+    }
+    return(psCmd);
+}
+
+//PSO֡ȺPSOsend()ںУFE֡ʽԭЭ飺֡β̶Ϊ0xFFУ飻
+//ЭCRCУCOBS֡ʽ֡һ˿ڵУ鷽ʽɺ֤
+static unsigned int SciPsoMarker(const tSciPort *psPort)
+{
+    return((psPort->ulCrcMode == CRC_MODE_SUM) && (psPort->ulFraming == SCI_FRAMING_FE));
+}
+
+//еĶβյֱ֡д
+static unsigned char *SciRxTail(tSciPort *psPort)
+{
+    return(psPort->psReq[psPort->ulReqTail % SCI_REQ_WINDOW].pucData);
+}
+
+//Уȷ֡ӣڶβ
+static void SciRxQueue(tSciPort *psPort, const tSciCmd *psCmd, unsigned int uiLength,
+                       unsigned int uiTxn, unsigned int uiStation)
+{
+    tSciReq *psReq = &psPort->psReq[psPort->ulReqTail % SCI_REQ_WINDOW];
+
+    psReq->psCmd = psCmd;
+    psReq->uiLength = uiLength - (psPort->uiTrailer - 1);
+    psReq->uiTxn = uiTxn;
+    psReq->uiStation = uiStation;
+    psPort->ulReqTail++;//
+}
+
+static unsigned long SciRxByte(tSciPort *psPort, unsigned char ucData)
+{
+
+    if(psPort->uiRxCount < PackHeadLength)//ǰ4֡ǰͷFE FE FE FE
+    {
+        //ȶİͷFEͬݴѰҰͷ
+        if(ucData != PackHead)
+        {
+            return(SCI_RX_DROP);
+        }
+        psPort->uiRxCount++;
+        return(SCI_RX_MORE);
+    }
+
+    if(psPort->uiRxCount < SCI_HEAD_END)//չ֡ͷ
     {
-        //ڰͷȣڿʼ
-        if(PackLength==3||PackLength==5||PackLength==7||PackLength==19)//
+        if(psPort->uiRxCount == PackHeadLength)
         {
-            if(RC_DataCount < PackLength)
+            psPort->uiRxSum = 0;
+            psPort->ulRxCrc = 0;
+            SciRxCheckByte(psPort, ucData);//У
+            psPort->uiRxDataCount = 0;
+            psPort->uiRxLength = ucData;
+            psPort->uiRxFlags = 0;
+            psPort->pucRxBuf = SciRxTail(psPort);
+            //ֱͨ֡ӽ
+            psPort->uiRxCount = (ucData == SCI_LONG_FRAME) ? (psPort->uiRxCount + 1) :
+                                                             SCI_HEAD_END;
+        }
+        else
+        {
+            SciRxCheckByte(psPort, ucData);
+            if(psPort->uiRxCount == PackHeadLength + 1)//־δλʱ֡
+            {
+                psPort->uiRxFlags = ucData;
+                psPort->uiRxLength = (ucData & ~SCI_FLAG_MASK) ? SCI_RXDATA_MAX + 1 : 0;
+            }
+            else if(psPort->uiRxCount == PackHeadLength + 2)//ֽ
+            {
+                psPort->uiRxLength |= ucData;
+            }
+            else if(psPort->uiRxCount == PackHeadLength + 3)//ֽ
+            {
+                psPort->uiRxLength |= (unsigned int)ucData << 8;
+            }
+            else if(psPort->uiRxCount == PackHeadLength + 4)//վţǱҲǹ㲥ʱ
             {
-                //Сڰʾδݲִϣʽڻ
-                RC_DataBUF[RC_DataCount++] = RCBUF[ReciveRCOUNT-1];
+                if((ucData != psPort->uiSortNumber) && (ucData != SCI_STATION_BROADCAST))
+                {
+                    return(SCI_RX_DROP);
+                }
+                psPort->uiRxStation = ucData;
             }
-            if(RC_DataCount == PackLength)   //һݽ
+            else//
             {
-                //ڰʾѾϣ
-                //ʽеĵ0վţ1кţ2룬ԼһУ뽻Ӧ
-                SerialNumber = RC_DataBUF[0];//к//ֻ8λ0~255
-                CommandCode = RC_DataBUF[1];//
-                CheckCode = RC_DataBUF[PackLength-1];//У
-                //÷ͱ־
-                flagRC = 1; //ݽս־λðݣ
-                ReciveRCOUNT = 0;
-                RC_DataCount = 0;
+                psPort->uiRxTxn = ucData;
             }
+            psPort->uiRxCount++;
+            //־ûеվš
+            if((psPort->uiRxCount == PackHeadLength + 4) &&
+               !(psPort->uiRxFlags & SCI_FLAG_STATION))
+            {
+                psPort->uiRxCount++;
+            }
+            if((psPort->uiRxCount == PackHeadLength + 5) &&
+               !(psPort->uiRxFlags & SCI_FLAG_TXN))
+            {
+                psPort->uiRxCount++;
+            }
+        }
+        if((psPort->uiRxCount == SCI_HEAD_END) &&
+           ((psPort->uiRxLength < (SCI_PACK_MIN + psPort->uiTrailer - 1)) ||
+            (psPort->uiRxLength > SCI_RXDATA_MAX)))
+        {
+            return(SCI_RX_DROP);
+        }
+    }
+    else
+    {
+        psPort->pucRxBuf[psPort->uiRxDataCount++] = ucData;
+        if(psPort->uiRxDataCount <= (psPort->uiRxLength - psPort->uiTrailer))
+        {
+            SciRxCheckByte(psPort, ucData);
         }
         else
         {
-            ReciveRCOUNT = 0;
-            RC_DataCount = 0;
+            psPort->uiRxSum += ucData;//УֻУ
         }
+
+        if(psPort->uiRxDataCount == 2)//뵽ȷǷ
+        {
+            psPort->psRxCmd = SciRxLookup(psPort, ucData, psPort->uiRxLength);
+            if(psPort->psRxCmd == 0)
+            {
+                return(SCI_RX_DROP);
+            }
+        }
+
+        if(psPort->uiRxDataCount == psPort->uiRxLength)//һݽ
+        {
+            if((psPort->psRxCmd->uiCheck || !SciPsoMarker(psPort)) && !SciRxCheckOk(psPort))
+            {
+                return(SCI_RX_DROP);
+            }
+            SciRxQueue(psPort, psPort->psRxCmd, psPort->uiRxLength,
+                       (psPort->uiRxFlags & SCI_FLAG_TXN) ? psPort->uiRxTxn :
+                                                            SCI_TXN_NONE,
+                       (psPort->uiRxFlags & SCI_FLAG_STATION) ? psPort->uiRxStation :
+                                                                SCI_STATION_NONE);
+            psPort->uiRxCount = 0;
+            return(SCI_RX_DONE);
+        }
+    }
+    return(SCI_RX_MORE);
+}
+
+//ڽյ֡½ֽ
+static void SciRxReset(tSciPort *psPort)
+{
+    psPort->uiRxCount = 0;
+    psPort->ulRxRawCount = 0;
+    psPort->ulRxPendHead = 0;
+    psPort->ulRxPendTail = 0;
+    CobsDecoderInit(&psPort->sRxCobs, SciRxTail(psPort), SCI_RXDATA_MAX);
+    if(psPort->ulFraming == SCI_FRAMING_MODBUS)
+    {
+        SciModbusRxReset(psPort);
     }
+}
 
+//֡һֽԭʼֽڷŻشǰ棬ѰҰͷ
+static void SciRxResync(tSciPort *psPort)
+{
+    unsigned long ulCount = psPort->ulRxRawCount - 1;
+    unsigned long ulPend = psPort->ulRxPendTail - psPort->ulRxPendHead;
 
+    //ʱǰֽ֡ȫԴߺϼһ֡
+    memmove(&psPort->pucRxPend[ulCount], &psPort->pucRxPend[psPort->ulRxPendHead], ulPend);
+    memcpy(psPort->pucRxPend, &psPort->pucRxRaw[1], ulCount);
+    psPort->ulRxPendHead = 0;
+    psPort->ulRxPendTail = ulCount + ulPend;
+    psPort->ulRxRawCount = 0;
+    psPort->uiRxCount = 0;
+    psPort->ulRxResync++;
 }
 
+//COBS֡к /  /  / У룬COBS0x00β
+//ͷͰҲվźţֻڵԵӣ
+//У鷽ʽȫֽ֮͵8λΪ0CRCʽУΪкݵCRC
+static unsigned int SciRxCobsCheck(tSciPort *psPort, const unsigned char *pucBuf,
+                                   unsigned int uiLength)
+{
+    unsigned int uiSum;
+    unsigned long ulCrc;
+    unsigned int i;
 
-//ʹ
-void TXdeal(void)
+    if(psPort->ulCrcMode == CRC_MODE_SUM)
+    {
+        uiSum = 0;
+        for(i = 0; i < uiLength; i++)
+        {
+            uiSum += pucBuf[i];
+        }
+        return((uiSum & 0x00FF) == 0);
+    }
+    ulCrc = CrcBlock(psPort->ulCrcMode, pucBuf, uiLength - psPort->uiTrailer);
+    if(psPort->ulCrcMode == CRC_MODE_16)
+    {
+        return(CodecGetU16(&pucBuf[uiLength-2]) == ulCrc);
+    }
+    return(CodecGetU32(&pucBuf[uiLength-4]) == ulCrc);
+}
+
+//COBS֡մÿδһֽڣ֡һָ
+static void SciRxCobs(tSciPort *psPort, unsigned char ucData)
 {
-	if(flagRC==1)   //ݽϣݽձ־λΪ1
-	{
+    const tSciCmd *psCmd;
+    unsigned char *pucBuf = psPort->sRxCobs.pucBuf;
+    unsigned int uiLength;
+    unsigned long ulResult;
 
-	   //ʵʱвط--ÿ4ֽ
-		if( (SerialNumber < 44)&&(CommandCode!=0xB1))
-		{
-			TXBUF[0] = 0X00FE;//ͷŵͻС
-			TXBUF[1] = 0X00FE;//ͷ
-			TXBUF[2] = 0X00FE;//ͷ
-			TXBUF[3] = 0X00FE;//ͷ
-			TXBUF[4] = 0X08;//--------------------
-			TXBUF[5] = SerialNumber;//к
-			TXBUF[6] = CommandCode;//
-			TXBUF[7] = ConfirmCode;//ȷ
-//1ֶλϲ
-//        SendData = Paramet[SerialNumber];//
-//        TXBUF[8] = SendData&0x00ff;//ݵֽ
-//        TXBUF[9] = (SendData&0xff00)>>8;//ݸֽ
-//2ṹں
-//        Data_send.all=Paramet[SerialNumber];
-//        TXBUF[8]=Data_send.bit.MEM1;
-//        TXBUF[9]=Data_send.bit.MEM2;
-
-			FData_send.all=Paramet[SerialNumber];
-			TXBUF[8]=FData_send.bit.MEM1;
-			TXBUF[9]=FData_send.bit.MEM2;
-			TXBUF[10]=FData_send.bit.MEM3;
-			TXBUF[11]=FData_send.bit.MEM4;
-
-			//datasum=TXBUF[4]+TXBUF[5]+TXBUF[6]+TXBUF[7]+TXBUF[8]+TXBUF[9];
-			datasum=TXBUF[4]+TXBUF[5]+TXBUF[6]+TXBUF[7]+TXBUF[8]+TXBUF[9]+TXBUF[10]+TXBUF[11];
-
-			datasum=~datasum+1;//У룺ȡ1
-			datasum &= 0X00FF;
-			TXBUF[12]=datasum;//У
-
-			TXCOUNT=0;//ͼ
-			flagSEND = 1;//ݱ־λ
-			SendDataNumber = 13;
+    ulResult = CobsDecodeByte(&psPort->sRxCobs, ucData);
+    if(ulResult == COBS_MORE)
+    {
+        return;
+    }
+    uiLength = psPort->sRxCobs.ulLength;
+    if((ulResult == COBS_FRAME) &&
+       (uiLength >= (SCI_PACK_MIN + psPort->uiTrailer - 1)))
+    {
+        psCmd = SciRxLookup(psPort, pucBuf[1], uiLength);
+        //COBS֡һ֤У룬PSO֡Ҳ
+        if(psCmd && SciRxCobsCheck(psPort, pucBuf, uiLength))
+        {
+            SciRxQueue(psPort, psCmd, uiLength, SCI_TXN_NONE, SCI_STATION_NONE);
+        }
+    }
+    //һ֡뵽µĶβ
+    CobsDecoderInit(&psPort->sRxCobs, SciRxTail(psPort), SCI_RXDATA_MAX);
+}
 
-		}
-		else if ((SerialNumber < 119)&&(SerialNumber > 43))//Բ\ϵ\ͣ·Ӧȷ
-		{
-			datasum=0;
-			TXBUF[0] = 0XFE;//ͷ
-			TXBUF[1] = 0XFE;//ͷ
-			TXBUF[2] = 0XFE;//ͷ
-			TXBUF[3] = 0XFE;//ͷ
-			TXBUF[4] = 0X04;//
-			TXBUF[5] = SerialNumber; //к
-			TXBUF[6] = CommandCode; //
-			TXBUF[7] = ConfirmCode;
-			datasum = TXBUF[4]+TXBUF[5]+TXBUF[6]+TXBUF[7];
-			datasum = (~datasum)+1; //У룺ȡ1
-			datasum &= 0X00FF;
-			TXBUF[8]=datasum; //У
-			TXCOUNT=0;
-			flagSEND = 1;
-			SendDataNumber = 9;
-		}
-		else if (CommandCode == 0xB1)   //ػ
-		{
-			TXBUF[0] = 0XFE;//ͷ
-			TXBUF[1] = 0XFE;//ͷ
-			TXBUF[2] = 0XFE;//ͷ
-			TXBUF[3] = 0XFE;//ͷ
-			TXBUF[4] = 0X04;//
-			TXBUF[5] = SerialNumber; //к
-			TXBUF[6] = CommandCode; //
-			TXBUF[7] = ConfirmCode; //ȷ
-			datasum = TXBUF[4]+TXBUF[5]+TXBUF[6]+TXBUF[7];
-			datasum = ~datasum+1; //У룺ȡ1
-			TXBUF[8]=datasum; //У
-			TXCOUNT=0;
-			flagSEND = 1;
-			SendDataNumber = 9;
-		}
-	}
+//ֽڼʱʱ䣬msuDMA8ֽͻˣ֡βҪȽճʱ32λʱ䣩
+//12ַʱټ2ms
+unsigned long SciRxTimeout(unsigned long ulBaud)
+{
+    return((10 * 12 * 1000) / ulBaud + 2);
 }
 
+void SciRecieve(tSciPort *psPort, unsigned char ucData)
+{
+    unsigned long ulResult;
+
+    //֡ķǰͷֽڲ
+    if((psPort->ulRxRawCount == 0) && (ucData != PackHead))
+    {
+        return;
+    }
+    psPort->pucRxRaw[psPort->ulRxRawCount++] = ucData;
+    ulResult = SciRxByte(psPort, ucData);
+    if(ulResult == SCI_RX_DONE)
+    {
+        psPort->ulRxRawCount = 0;
+    }
+    else if(ulResult == SCI_RX_DROP)
+    {
+        SciRxResync(psPort);
+    }
+}
+
+//˿Э״̬ʼϵĬϲʡУ顢˿õ֡ʽڴUARTжǰ
+void SciRxInit(tSciPort *psPort)
+{
+    psPort->ulReqHead = 0;
+    psPort->ulReqTail = 0;
+    psPort->ulBaud = SCI_BAUD_DEFAULT;
+    psPort->ulBaudState = SCI_BAUD_IDLE;
+    psPort->ulCrcMode = CRC_MODE_SUM;
+    psPort->uiTrailer = CrcLength(CRC_MODE_SUM);
+    psPort->ulFraming = psPort->psConfig->ulFraming;
+    psPort->uiSortNumber = SortNo;
+    psPort->ulRxTimeout = SciRxTimeout(SCI_BAUD_DEFAULT);
+    SciRingInit(&psPort->sRxRing);
+    SciRxReset(psPort);
+}
+
+
+//һ֡к---У룩+ݷ뽻C28Ļλ
+//ʱusMBufferУѭ
+static void SciIpcSend(const unsigned char *pucData, unsigned int uiLength)
+{
+    unsigned int i;
+
+    usMBuffer[0] = uiLength;
+    for(i = 1; i < uiLength; i++)
+    {
+        usMBuffer[i] = pucData[i-1];
+    }
+    if(!IpcRingPut(usMBuffer, uiLength))
+    {
+        IPC_send_flag = 1;
+    }
+}
+
+//ѵǰ֡C28
+static void SciIpcFrame(void)
+{
+    SciIpcSend(RC_DataBUF, PackLength);
+}
 
-void Checkdata(void)//ж
+//pucStartpucEnd֮ǰУ飬˿ڵǰУ鷽ʽдpucEnd
+static void SciTxCheck(tSciPort *psPort, const unsigned char *pucStart,
+                       unsigned char *pucEnd)
 {
-        if(TXCOUNT==0) //ͶΪ
+    unsigned int uiSum;
+
+    if(psPort->ulCrcMode == CRC_MODE_SUM)
+    {
+        uiSum = 0;
+        while(pucStart < pucEnd)
         {
-            if(flagRC==1)//նΪ,ʾܶɣյݰȫȷ
-            {
-                unsigned int i;
-                ReciveRCOUNT=0;
-				if(PackLength==19)//Ƿ19жǷΪȺ
-				{
-					int i;
-					if(SerialNumber=200&&CheckCode==0xff)
-					{
-						for(i=0;i<4;i++)
-						{
-							PSO_get.bit.MEM1=RC_DataBUF[4*i+2];
-							PSO_get.bit.MEM2=RC_DataBUF[4*i+3];
-							PSO_get.bit.MEM3=RC_DataBUF[4*i+4];
-							PSO_get.bit.MEM4=RC_DataBUF[4*i+5];
-							PSO_g[i]=PSO_get.all;
-
-							IPC_send_flag=1;
-						}
-					}
-
-                    //IPC
-                    i = 0;
-                    usMBuffer[i]=PackLength;
-                    for (i=1; i< PackLength; i++)
-                    {
-                        usMBuffer[i]=RC_DataBUF[i-1];
-                    }
-
-					flagRC = 0;
-				}
-				else
-				{
-	                datasum = 0;//xyyע⣬˱øΪֲ
-	                //֤ǷȷͷһУȡȻУȽ
-	                for(i=0;i<(PackLength-1);i++)
-	                {
-	                    datasum += RC_DataBUF[i];
-	                }
-	                datasum += PackLength;
-	                datasum =~ datasum+1;
-	                datasum &= 0X00FF;
-	                datasum1 = datasum ;
-
-				   if(datasum == CheckCode) //ȷdatasum =У룩
-				   {
-						if(PackLength==5&&CommandCode==0xB1)//Ƿ5-жϿػ
-						{
-							//if(CommandCode==0xB1)
-							//{
-								//Switchsystem = RC_DataBUF[2]+((RC_DataBUF[3]<<8)&0xff00);
-								Data_get.bit.MEM1=RC_DataBUF[2];
-								Data_get.bit.MEM2=RC_DataBUF[3];
-								Switchsystem=Data_get.all;
-
-								IPC_send_flag=1;
-							//}
-						}
-						if(PackLength==7)//Ƿ7//Ǵӻʾ޸ҪǶӦĴӻ
-						{
-							FData_get.bit.MEM1=RC_DataBUF[2];
-							FData_get.bit.MEM2=RC_DataBUF[3];
-							FData_get.bit.MEM3=RC_DataBUF[4];
-							FData_get.bit.MEM4=RC_DataBUF[5];
-							Paramet[SerialNumber]=FData_get.all;
-
-							IPC_send_flag=1;
-						}
-
-
-						//IPC
-                        int i = 0;
-						usMBuffer[i]=PackLength;
-                        for (i=1; i< PackLength; i++)
-                        {
-                            usMBuffer[i]=RC_DataBUF[i-1];
-                        }
-
-                        TXdeal(); //жͷͳ
-					}
-					else //ոʽ
-					{
-						flagRC = 0;
-					}
-				}
-            }
+            uiSum += *pucStart++;
+        }
+        *pucEnd = (~uiSum)+1; //У룺ȡ1
+    }
+    else if(psPort->ulCrcMode == CRC_MODE_16)
+    {
+        CodecPutU16(pucEnd, CrcBlock(CRC_MODE_16, pucStart, pucEnd - pucStart));
+    }
+    else
+    {
+        CodecPutU32(pucEnd, CrcBlock(CRC_MODE_32, pucStart, pucEnd - pucStart));
+    }
+}
+
+//COBS֡pucEndдУ飬ͬУԭر뵽pucFrameʼֽ֡
+static unsigned long SciFrameCobs(tSciPort *psPort, unsigned char *pucFrame,
+                                  unsigned char *pucData, unsigned char *pucEnd)
+{
+    SciTxCheck(psPort, pucData, pucEnd);
+    return(CobsEncode(pucData, (pucEnd - pucData) + psPort->uiTrailer, pucFrame));
+}
+
+//ͨ֡кдpucFrame+5pucEndΪĩβ
+//дͷУ飬ֽ֡
+unsigned long SciFrameShort(tSciPort *psPort, unsigned char *pucFrame,
+                            unsigned char *pucEnd)
+{
+    unsigned int uiLength;
+
+    if(psPort->ulFraming == SCI_FRAMING_COBS)
+    {
+        return(SciFrameCobs(psPort, pucFrame, &pucFrame[5], pucEnd));
+    }
+
+    uiLength = (pucEnd - &pucFrame[5]) + psPort->uiTrailer;//У
+    pucFrame[0] = 0XFE;//ͷ
+    pucFrame[1] = 0XFE;//ͷ
+    pucFrame[2] = 0XFE;//ͷ
+    pucFrame[3] = 0XFE;//ͷ
+    pucFrame[4] = uiLength;//
+    SciTxCheck(psPort, &pucFrame[4], pucEnd);
+    return(5 + uiLength);
+}
+
+//չ֡ͷȣվšʱ1ֽ
+static unsigned int SciFrameExtHead(unsigned int uiStation, unsigned int uiTxn)
+{
+    return(SCI_LONG_HEAD + ((uiStation != SCI_STATION_NONE) ? 1 : 0) +
+           ((uiTxn != SCI_TXN_NONE) ? 1 : 0));
+}
+
+//չ֡кpucFrame+SciFrameExtHead()pucEndΪĩβ
+//дͷ16λվšźУ飬ֽ֡
+static unsigned long SciFrameExt(tSciPort *psPort, unsigned char *pucFrame,
+                                 unsigned char *pucEnd,
+                                 unsigned int uiStation, unsigned int uiTxn)
+{
+    unsigned int uiHead;
+    unsigned int uiLength;
+    unsigned char *pucHead;
+
+    uiHead = SciFrameExtHead(uiStation, uiTxn);
+    if(psPort->ulFraming == SCI_FRAMING_COBS)
+    {
+        return(SciFrameCobs(psPort, pucFrame, &pucFrame[uiHead], pucEnd));
+    }
+    uiLength = (pucEnd - &pucFrame[uiHead]) + psPort->uiTrailer;//У
+    pucFrame[0] = 0XFE;//ͷ
+    pucFrame[1] = 0XFE;//ͷ
+    pucFrame[2] = 0XFE;//ͷ
+    pucFrame[3] = 0XFE;//ͷ
+    pucFrame[4] = SCI_LONG_FRAME;
+    pucFrame[5] = 0;//־
+    CodecPutU16(&pucFrame[6], uiLength);
+    pucHead = &pucFrame[SCI_LONG_HEAD];
+    if(uiStation != SCI_STATION_NONE)
+    {
+        pucFrame[5] |= SCI_FLAG_STATION;
+        *pucHead++ = uiStation;
+    }
+    if(uiTxn != SCI_TXN_NONE)
+    {
+        pucFrame[5] |= SCI_FLAG_TXN;
+        *pucHead++ = uiTxn;
+    }
+    SciTxCheck(psPort, &pucFrame[4], pucEnd);
+    return(uiHead + uiLength);
+}
+
+//չ֡кдpucFrame+SCI_LONG_HEADpucEndΪĩβ
+//дͷ16λУ飬ֽ֡
+unsigned long SciFrameLong(tSciPort *psPort, unsigned char *pucFrame,
+                           unsigned char *pucEnd)
+{
+    return(SciFrameExt(psPort, pucFrame, pucEnd, SCI_STATION_NONE, SCI_TXN_NONE));
+}
+
+static unsigned char *g_pucSciTxFrame; //ɵӦ֡λڷͶеĿ
+
+//Ӧ֡վţվʱվ
+static unsigned int SciTxStation(void)
+{
+    return((g_uiSciStation == SCI_STATION_NONE) ? SCI_STATION_NONE :
+                                                   g_psSciPort->uiSortNumber);
+}
+
+//Ӧ֡Ƿչ֡վŻʱͬվšŵչ֡Ӧ
+static unsigned int SciTxLong(unsigned int uiLong)
+{
+    return(uiLong || (g_uiSciStation != SCI_STATION_NONE) ||
+           (g_uiSciTxn != SCI_TXN_NONE));
+}
 
+//ӦʼλãCheckdata()ȷϷͶп
+static unsigned char *SciTxBegin(unsigned int uiLong)
+{
+    g_pucSciTxFrame = SciTxqAlloc(g_psSciPort);
+    if(SciTxLong(uiLong))
+    {
+        return(&g_pucSciTxFrame[SciFrameExtHead(SciTxStation(), g_uiSciTxn)]);
+    }
+    return(&g_pucSciTxFrame[5]);
+}
+
+//Ӧ֡ɣpucEndΪĩβдͷУ뷢ͶУ㲥֡Ӧ
+static void SciTxEnd(unsigned int uiLong, unsigned char *pucEnd)
+{
+    unsigned long ulLength;
+
+    if(g_uiSciStation == SCI_STATION_BROADCAST)
+    {
+        return;
+    }
+    if(SciTxLong(uiLong))
+    {
+        ulLength = SciFrameExt(g_psSciPort, g_pucSciTxFrame, pucEnd, SciTxStation(),
+                               g_uiSciTxn);
+    }
+    else
+    {
+        ulLength = SciFrameShort(g_psSciPort, g_pucSciTxFrame, pucEnd);
+    }
+    SciTxqPush(g_psSciPort, SCI_TXQ_CTRL, g_pucSciTxFrame, ulLength, 0);
+}
+
+///ȷӦк++Ӧ
+void SciTxAck(unsigned int uiCode)
+{
+    unsigned char *pucData = SciTxBegin(0);
+
+    *pucData++ = SerialNumber; //к
+    *pucData++ = CommandCode; //
+    *pucData++ = uiCode; //Ӧ
+    SciTxEnd(0, pucData);
+}
+
+//չ֡Ӧдкš롢ȷ룬ʼλ
+static unsigned char *SciTxLongBegin(void)
+{
+    unsigned char *pucData = SciTxBegin(1);
+
+    *pucData++ = SerialNumber;//к
+    *pucData++ = CommandCode;//
+    *pucData++ = ConfirmCode;//ȷ
+    return(pucData);
+}
+
+//չ֡ӦpucEndΪĩβ֡
+static void SciTxLongEnd(unsigned char *pucEnd)
+{
+    SciTxEnd(1, pucEnd);
+}
+
+//ΪʼšӦΪʼšֵ
+void SciCmdBulkRead(void)
+{
+    unsigned int uiStart = RC_DataBUF[2];
+    unsigned int uiCount = RC_DataBUF[3];
+    unsigned char *pucData;
+
+    if((uiCount == 0) || ((uiStart + uiCount) > ParameterNumber))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    pucData = SciTxLongBegin();
+    *pucData++ = uiStart;
+    *pucData++ = uiCount;
+    while(uiCount--)
+    {
+        CodecPutFloat(pucData, Paramet[uiStart++]);
+        pucData += 4;
+    }
+    SciTxLongEnd(pucData);
+}
+
+//ΪλͼnλӦParamet[n]λǰӦΪλͼеĲֵ
+void SciCmdBulkReadMap(void)
+{
+    unsigned int i;
+    unsigned char *pucData;
+
+    pucData = SciTxLongBegin();
+    for(i = 0; i < SCI_PARAM_MAP_BYTES; i++)
+    {
+        *pucData++ = RC_DataBUF[2+i];
+    }
+    for(i = 0; i < ParameterNumber; i++)
+    {
+        if(RC_DataBUF[2+(i>>3)] & (1 << (i & 7)))
+        {
+            CodecPutFloat(pucData, Paramet[i]);
+            pucData += 4;
         }
-        else
+    }
+    SciTxLongEnd(pucData);
+}
+
+//дΪʼšĲֵ
+//ȼ֡һԸParametдĲCheckdata()ϳһϢC28
+//C28ῴֻһĲ
+void SciCmdBulkWrite(void)
+{
+    unsigned int uiStart = RC_DataBUF[2];
+    unsigned int uiCount = RC_DataBUF[3];
+    unsigned int i;
+
+    if((uiCount == 0) || ((uiStart + uiCount) > ParameterNumber) ||
+       (PackLength != (5 + 4 * uiCount)))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        Paramet[uiStart + i] = CodecGetFloat(&RC_DataBUF[4 + 4 * i]);
+        IpcSyncMark(uiStart + i);
+    }
+    SciTxAck(ConfirmCode);
+}
+
+//дΪ飨+ֵſɲ
+void SciCmdBulkWriteMap(void)
+{
+    unsigned int uiCount = RC_DataBUF[2];
+    unsigned int i;
+
+    if((uiCount == 0) || (PackLength != (4 + 5 * uiCount)))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        if(RC_DataBUF[3 + 5 * i] >= ParameterNumber)
         {
+            SciTxAck(RejectCode);
+            return;
         }
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        Paramet[RC_DataBUF[3 + 5 * i]] = CodecGetFloat(&RC_DataBUF[4 + 5 * i]);
+        IpcSyncMark(RC_DataBUF[3 + 5 * i]);
+    }
+    SciTxAck(ConfirmCode);
 }
 
+//Э̣ԵǰӦӦϺSciBaudProcess()л
+void SciCmdBaud(void)
+{
+    unsigned long ulBaud;
 
+    ulBaud = CodecGetU32(&RC_DataBUF[2]);
+    //UARTʱΪʵ16
+    if((ulBaud < SCI_BAUD_MIN) ||
+       (ulBaud > (SysCtlClockGet(SYSTEM_CLOCK_SPEED) / 16)))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    g_psSciPort->ulBaudNew = ulBaud;
+    g_psSciPort->ulBaudState = SCI_BAUD_PENDING;
+    SciTxAck(ConfirmCode);
+}
 
-//SCIʹ
-void SciSend(void)
+//˿ڵUARTлָ
+void SciBaudSet(tSciPort *psPort, unsigned long ulBaud)
 {
-    if(flagSEND == 1)
+    UARTConfigSetExpClk(psPort->psConfig->ulBase, SysCtlClockGet(SYSTEM_CLOCK_SPEED),
+                        ulBaud,
+                        (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE |
+                         UART_CONFIG_PAR_NONE));
+    psPort->ulBaud = ulBaud;
+    psPort->ulRxTimeout = SciRxTimeout(ulBaud);
+    SciRxReset(psPort);//лǰδݰ
+}
+
+//Э̴ѭе
+void SciBaudProcess(tSciPort *psPort)
+{
+    if(psPort->ulBaudState == SCI_BAUD_PENDING)
     {
-        //һݻû,պͷͰͬʱSendDataNumberTXdeal()и
-        if(TXCOUNT < SendDataNumber)
+        //ӦһֽƳλĴл
+        if(SciTxqIdle(psPort) && !UARTBusy(psPort->psConfig->ulBase))
         {
-            //SciaRegs.SCITXBUF = TXBUF[TXCOUNT] ;//& 0X00FF;//ͣٴȷΪ8λݣĴֽڵ
-            UARTCharPutNonBlocking(UART1_BASE, TXBUF[TXCOUNT]);
-            TXCOUNT++;
+            psPort->ulBaudOld = psPort->ulBaud;
+            SciBaudSet(psPort, psPort->ulBaudNew);
+            psPort->ulBaudTime = g_ulTickMs;
+            psPort->ulBaudState = SCI_BAUD_TRIAL;
         }
-        else//һѾͽ
+    }
+    else if(psPort->ulBaudState == SCI_BAUD_TRIAL)
+    {
+        //ʱδյЧݰָԭ
+        if((g_ulTickMs - psPort->ulBaudTime) >= SCI_BAUD_TIMEOUT)
         {
-            flagRC = 0;
-            flagSEND = 0;
-            TXCOUNT = 0;
-            //ClrTxbuf();
+            SciBaudSet(psPort, psPort->ulBaudOld);
+            psPort->ulBaudState = SCI_BAUD_IDLE;
         }
+    }
+}
 
+//У鷽ʽЭ̣Ӧ԰ԭʽУ飬֮շʹ·ʽ
+//ӵĺԭʽУ飬ӦյӦٷ
+void SciCmdCrc(void)
+{
+    unsigned long ulMode = RC_DataBUF[2];
+
+    if(ulMode > CRC_MODE_32)
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    SciTxAck(ConfirmCode);
+    g_psSciPort->ulCrcMode = ulMode;
+    g_psSciPort->uiTrailer = CrcLength(ulMode);
+}
 
+//ͨѶͳƣΪ1ֽڣ0ʾȡ㣻uDMA˿ڹãΪ˿ڵͳ
+//ӦΪȼķֽ֡/ۼʱ(ms)Լ֡
+//ջֽuDMAվ֡ѰҰͷ
+//ֽڼʱΪ32λ
+void SciCmdStats(void)
+{
+    tSciPort *psPort = g_psSciPort;
+    unsigned char *pucData;
+    tSciTxStats *psStats;
+    unsigned int i;
 
+    pucData = SciTxLongBegin();
+    for(i = 0; i < SCI_TXQ_CLASSES; i++)
+    {
+        psStats = &psPort->psTxStats[i];
+        CodecPutU32(pucData, psStats->ulFrames);
+        CodecPutU32(pucData + 4, psStats->ulBytes);
+        CodecPutU32(pucData + 8, psStats->ulLatencyMax);
+        CodecPutU32(pucData + 12, psStats->ulLatencySum);
+        pucData += 16;
+        if(RC_DataBUF[2])
+        {
+            psStats->ulFrames = 0;
+            psStats->ulBytes = 0;
+            psStats->ulLatencyMax = 0;
+            psStats->ulLatencySum = 0;
+        }
     }
+    CodecPutU32(pucData, psPort->ulRxOverrun);
+    CodecPutU32(pucData + 4, psPort->ulRxFraming);
+    CodecPutU32(pucData + 8, psPort->sRxRing.ulDrop);
+    CodecPutU32(pucData + 12, g_ulSciDmaErrCount);
+    CodecPutU32(pucData + 16, psPort->ulStationSkip);
+    CodecPutU32(pucData + 20, psPort->ulRxResync);
+    CodecPutU32(pucData + 24, psPort->ulRxTimeouts);
+    pucData += 28;
+    if(RC_DataBUF[2])
+    {
+        psPort->ulRxOverrun = 0;
+        psPort->ulRxFraming = 0;
+        psPort->sRxRing.ulDrop = 0;
+        g_ulSciDmaErrCount = 0;
+        psPort->ulStationSkip = 0;
+        psPort->ulRxResync = 0;
+        psPort->ulRxTimeouts = 0;
+    }
+    SciTxLongEnd(pucData);
 }
 
+//֡ʽЭ̣Ӧ԰ԭʽ֮ͣշʹ¸ʽ
+//ӵĺԭʽӦյӦٷ
+//лΪModbus RTU˿ڲٴЭ֡λָ˿õ֡ʽ
+void SciCmdFraming(void)
+{
+    if(RC_DataBUF[2] > SCI_FRAMING_MODBUS)
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    SciTxAck(ConfirmCode);
+    g_psSciPort->ulFraming = RC_DataBUF[2];
+    SciRxReset(g_psSciPort);
+}
+
+//ñվţӦԴԭվţ֮վŹˣ㲥վŲΪվ
+void SciCmdStation(void)
+{
+    if(RC_DataBUF[2] == SCI_STATION_BROADCAST)
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    SciTxAck(ConfirmCode);
+    g_psSciPort->uiSortNumber = RC_DataBUF[2];
+}
+
+//ػ
+void SciCmdOnOff(void)
+{
+    Switchsystem = CodecGetU16(&RC_DataBUF[2]);
+
+    SciIpcFrame();
+    TXdeal();
+}
+
+//ӦTXdeal()
+void SciCmdRead(void)
+{
+    TXdeal();
+}
+
+//дǴӻʾ޸ҪǶӦĴӻ
+void SciCmdWrite(void)
+{
+    if(SerialNumber < ParameterNumber)
+    {
+        Paramet[SerialNumber] = CodecGetFloat(&RC_DataBUF[2]);
+        IpcSyncMark(SerialNumber);
+    }
+    TXdeal();
+}
+
+//ȺӦЭCRCУCOBS֡ʽʱ֡ͨУ飬֡β0xFF
+void SciCmdPso(void)
+{
+    int i;
+
+    if((SerialNumber == 200) && (!SciPsoMarker(g_psSciPort) || (CheckCode == 0xff)))
+    {
+        for(i=0;i<4;i++)
+        {
+            PSO_g[i] = CodecGetFloat(&RC_DataBUF[4*i+2]);
+        }
+        SciIpcFrame();
+    }
+}
+
+
+//ջѭе
+void SciRxProcess(tSciPort *psPort)
+{
+    unsigned char ucData;
+
+    //Modbus RTUճʱжϼ¼֡β֡ȡ
+    if(psPort->ulFraming == SCI_FRAMING_MODBUS)
+    {
+        SciModbusRxProcess(psPort);
+        return;
+    }
+
+    //ʱֽͣڱڻ
+    while((psPort->ulReqTail - psPort->ulReqHead) < SCI_REQ_WINDOW)
+    {
+        if(psPort->ulRxPendHead != psPort->ulRxPendTail)
+        {
+            ucData = psPort->pucRxPend[psPort->ulRxPendHead++];
+        }
+        else if(SciRingGet(&psPort->sRxRing, &ucData))
+        {
+            psPort->ulRxTime = g_ulTickMs;
+        }
+        else
+        {
+            break;
+        }
+        if(psPort->ulFraming == SCI_FRAMING_COBS)
+        {
+            SciRxCobs(psPort, ucData);
+        }
+        else
+        {
+            SciRecieve(psPort, ucData);
+        }
+    }
+
+    //֡δֽڼʱͷжϸ֡󣩣֡
+    //յֽпһ֡ͬѰҰͷ
+    if(psPort->ulRxRawCount &&
+       (psPort->ulRxPendHead == psPort->ulRxPendTail) &&
+       ((g_ulTickMs - psPort->ulRxTime) > psPort->ulRxTimeout))
+    {
+        SciRxResync(psPort);
+        psPort->ulRxTimeouts++;
+    }
+}
+
+
+//ʹ
+void TXdeal(void)
+{
+	if(flagRC==1)   //ݽϣݽձ־λΪ1
+	{
+
+	   //ʵʱвط--ÿ4ֽ
+		if( (SerialNumber < SCI_CACHE_NUM)&&(CommandCode!=On_off_Code))
+		{
+			unsigned char *pucData;
+
+			//վšŵĶֱӷͻ֡
+			if((g_uiSciTxn == SCI_TXN_NONE) && (g_uiSciStation == SCI_STATION_NONE) &&
+			   SciCacheSend(g_psSciPort, SerialNumber, CommandCode))
+			{
+				return;
+			}
+			pucData = SciTxBegin(0);
+
+			pucData[0] = SerialNumber;//к
+			pucData[1] = CommandCode;//
+			pucData[2] = ConfirmCode;//ȷ
+			CodecPutFloat(&pucData[3], Paramet[SerialNumber]);//ݣֽǰ
+			SciTxEnd(0, &pucData[7]);//ͷУ룬
+		}
+		//Բ\ϵ\ͣ·Ӧȷ
+		else if(((SerialNumber < 119)&&(SerialNumber >= SCI_CACHE_NUM)) ||
+		        (CommandCode == On_off_Code))
+		{
+			SciTxAck(ConfirmCode);
+		}
+	}
+}
+
+
+//жϣ˿еĶ󣬴ڼg_psSciPortָö˿
+//C28Ļλһ֡usMBufferʱݻ˿ڹusMBuffer
+void Checkdata(tSciPort *psPort)
+{
+    tSciReq *psReq;
+
+    //Уȷ󣬲ҷͶпɷӦ
+    if((psPort->ulReqHead != psPort->ulReqTail) && !IPC_send_flag &&
+       (SciTxqCount(psPort, SCI_TXQ_CTRL) < SCI_TXQ_SIZE))
+    {
+        g_psSciPort = psPort;
+        psReq = &psPort->psReq[psPort->ulReqHead % SCI_REQ_WINDOW];
+        RC_DataBUF = psReq->pucData;
+        PackLength = psReq->uiLength;
+        SerialNumber = RC_DataBUF[0];//к//ֻ8λ0~255
+        CommandCode = RC_DataBUF[1];//
+        CheckCode = RC_DataBUF[PackLength-1];//У
+        g_uiSciTxn = psReq->uiTxn;
+        g_uiSciStation = psReq->uiStation;
+        flagRC = 1; //ݽս־λðݣ
+
+        //²յЧݰȷлɹ
+        if(psPort->ulBaudState == SCI_BAUD_TRIAL)
+        {
+            psPort->ulBaudState = SCI_BAUD_IDLE;
+        }
+        psReq->psCmd->pfnHandler();
+        //дĲϳһϢC28
+        IpcSyncProcess();
+
+        //Ӧѷ뷢ͶУӣڽպ
+        psPort->ulReqHead++;
+        flagRC = 0;
+    }
+}
+
+
+
+static unsigned long g_ulPsoTicket; //PSO֡ڷͶе
+static unsigned long g_ulPsoLength; //PSOֽ֡֡
 
 //PSOͳ
-//ʱ͸λ
+//ʱ͸λԭеUART1ӷ
+//УFE֡ʽΪԭе48ֽڹ̶֡֡βΪУ0xFF
+//ЭCRCУCOBS֡ʽͷ֡βӦ֡һSciFrameShort()
+//˿ЭΪModbus RTUվ
 void PSOsend(float U[10])
 {
+    tSciPort *psPort = g_ppsSciPort[SCI_PORT_UART1];
 
-    if(PSOSENDF)//0.05s󣬷һ
+    if(PSOSENDF && (psPort->ulFraming != SCI_FRAMING_MODBUS))//0.05s󣬷һ
     {
         if(PSO_datainit_flag==0)
         {
             int i;
-            for(i=0;i<4;i++)
+            unsigned char *pucData = &PSOBUF[5];
+
+            *pucData++ = 200;//к
+            *pucData++ = 0xFF;//
+            for(i=0;i<10;i++)
             {
-                PSOBUF[i]=0xFE;
+                CodecPutFloat(pucData, U[i]);
+                pucData += 4;
             }
-            PSOBUF[4]=43;
-            PSOBUF[5]=200;
-            PSOBUF[6]=0xFF;
-            for(i=0;i<10;i++)
+            if(SciPsoMarker(psPort))
             {
-                FData_get.all=U[i];
-                PSOBUF[4*i+7]=FData_get.bit.MEM1;
-                PSOBUF[4*i+8]=FData_get.bit.MEM2;
-                PSOBUF[4*i+9]=FData_get.bit.MEM3;
-                PSOBUF[4*i+10]=FData_get.bit.MEM4;
+                for(i=0;i<PackHeadLength;i++)
+                {
+                    PSOBUF[i]=PackHead;
+                }
+                PSOBUF[4]=PSONumber-5;//
+                *pucData=0XFF;//У
+                g_ulPsoLength = PSONumber;
+            }
+            else
+            {
+                g_ulPsoLength = SciFrameShort(psPort, PSOBUF, pucData);
             }
-
-            PSOBUF[PSONumber-1]=0XFF;//У
             PSO_datainit_flag=1;
         }
         else
         {
-            if(PSOCOUNT < PSONumber)
+            if(PSOCOUNT == 0)
             {
-                //SciaRegs.SCITXBUF = PSOBUF[PSOCOUNT] ;//& 0X00FF;//ͣٴȷΪ8λݣĴֽڵ
-                UARTCharPutNonBlocking(UART1_BASE,PSOBUF[PSOCOUNT]);
-                PSOCOUNT++;
+                //뷢ͶУʱ´ٷ
+                if(SciTxqPush(psPort, SCI_TXQ_BULK, PSOBUF, g_ulPsoLength, &g_ulPsoTicket))
+                {
+                    PSOCOUNT = g_ulPsoLength;
+                }
             }
-            else
+            else if(SciTxqDone(psPort, SCI_TXQ_BULK, g_ulPsoTicket))
             {
                 PSOCOUNT = 0;
                 PSO_datainit_flag=0;
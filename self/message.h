@@ -4,31 +4,7 @@
 #define Uint16 unsigned int
 #define int16  int
 
-//----------------------------------float communication
-struct FLOAT_COMMUNICATION_BITS {     // bits  description
-	Uint16  MEM1:8;      // 7:0
-	Uint16  MEM2:8;   // 15:8
-
-};
-
-union FLOAT_COM{
-   int16                all;
-   struct FLOAT_COMMUNICATION_BITS   bit;
-};
-
-//----------------------------------float communication
-struct FLOAT_COMMUNICATION_BITSF {     // bits  description
-	Uint16  MEM1:8;      // 7:0
-	Uint16  MEM2:8;   // 15:8
-	Uint16  MEM3:8;      //23:16
-	Uint16  MEM4:8;   // 31:24
-};
-
-union FLOAT_COMF {
-   float                all;
-   struct FLOAT_COMMUNICATION_BITSF   bit;
-};
-
+//----------------------------------float IPC
 struct FLOAT_IPC_BITSF {     // bits  description
     Uint16  MEM1:16;      // 15:0
     Uint16  MEM2:16;   // 32:16
@@ -39,10 +15,44 @@ union FLOAT_IPCF {
    struct FLOAT_IPC_BITSF   bit;
 };
 
-extern void SciRecieve(void);
-extern void SciSend(void);
+//----------------------------------SCI
+typedef struct
+{
+    Uint16 uiCode;      //룬SCI_CMD_ANYʾƥ
+    Uint16 uiLength;    //кУ룩SCI_LEN_ANYʾɱ
+    Uint16 uiCheck;     //1:֤У 0:֤
+    void (*pfnHandler)(void); //ѭе
+} tSciCmd;
+
+typedef struct tSciPortS tSciPort;//SCIЭ˿ڣsci_port.h
+
+extern void SciCmdInit(void);
+extern void SciCmdOnOff(void);
+extern void SciCmdRead(void);
+extern void SciCmdWrite(void);
+extern void SciCmdPso(void);
+extern void SciCmdBulkRead(void);
+extern void SciCmdBulkReadMap(void);
+extern void SciCmdBulkWrite(void);
+extern void SciCmdBulkWriteMap(void);
+extern void SciCmdBaud(void);
+extern void SciCmdCrc(void);
+extern void SciCmdStats(void);
+extern void SciCmdStation(void);
+extern void SciCmdFraming(void);
+extern void SciBaudSet(tSciPort *psPort, unsigned long ulBaud);
+extern void SciBaudProcess(tSciPort *psPort);
+extern void SciTxAck(unsigned int uiCode);
+extern unsigned long SciFrameShort(tSciPort *psPort, unsigned char *pucFrame,
+                                   unsigned char *pucEnd);
+extern unsigned long SciFrameLong(tSciPort *psPort, unsigned char *pucFrame,
+                                  unsigned char *pucEnd);
+extern void SciRecieve(tSciPort *psPort, unsigned char ucData);
+extern unsigned long SciRxTimeout(unsigned long ulBaud);
+extern void SciRxInit(tSciPort *psPort);
+extern void SciRxProcess(tSciPort *psPort);
 extern void TXdeal(void);
-extern void Checkdata(void);
+extern void Checkdata(tSciPort *psPort);
 extern void ClrTxbuf(void);
 extern void cltran(void);
 extern void PSOsend(float U[10]);
@@ -54,7 +64,5 @@ void Error(void);
 void CtoMIPC1IntHandler(void);
 void CtoMIPC2IntHandler(void);
 void IPCdata_tran(void);
-//UART
-void UARTIntHandler(void);
-void UARTIntHandler(void);
+void SysTickIntHandler(void);
 #endif
@@ -0,0 +1,315 @@
+/*
+ *     modbus.c
+ *
+ *     Modbus RTUվ/ĴĴӳ䵽Paramet뱾Э鹲ýաкͷͶ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "codec.h"
+#include "crc.h"
+#include "ipc_sync.h"
+
+//CRCȷ֡УCheckdata()SciCmdModbus()
+static const tSciCmd g_sSciModbusCmd = { SCI_CMD_ANY, SCI_LEN_ANY, 0, SciCmdModbus };
+
+//Ѽ¼֡βջеֽںݴİл֡ʽʱ
+void SciModbusRxReset(tSciPort *psPort)
+{
+    tSciModbusRx *psRx = &psPort->sModbus;
+
+    psRx->ulTail = psRx->ulHead;
+    psPort->sRxRing.ulTail = psPort->sRxRing.ulHead;
+    psPort->sModbusStage.uiHalf = 0;
+}
+
+//ڽճʱжеãתuDMAFIFOеֽڣ¼֡β
+//ֻдûֽʱ¼֡β¼ʱ¼֡ΪһΣCRC
+void SciModbusRxMark(tSciPort *psPort)
+{
+    tSciModbusRx *psRx = &psPort->sModbus;
+    unsigned long ulHead = psRx->ulHead;
+    unsigned long ulEnd = psPort->sRxRing.ulHead;
+
+    if((ulEnd == psRx->ulLast) || ((ulHead - psRx->ulTail) >= SCI_MODBUS_MARK_NUM))
+    {
+        return;
+    }
+    psRx->pulMark[ulHead & (SCI_MODBUS_MARK_NUM - 1)] = ulEnd;
+    psRx->ulLast = ulEnd;
+    //д֡βٷд
+    psRx->ulHead = ulHead + 1;
+}
+
+//֡飺ȺCRC
+static unsigned int SciModbusRxCheck(const unsigned char *pucBuf, unsigned long ulLength)
+{
+    if((ulLength < SCI_MODBUS_FRAME_MIN) || (ulLength > SCI_RXDATA_MAX))
+    {
+        return(0);
+    }
+    return(CrcModbus(pucBuf, ulLength - 2) == CodecGetU16(&pucBuf[ulLength - 2]));
+}
+
+//մSciRxProcess()ѭеã֡βȡֱ֡деĿ
+//һ֡βֽ֮ڻû֡ڻ
+void SciModbusRxProcess(tSciPort *psPort)
+{
+    tSciModbusRx *psRx = &psPort->sModbus;
+    tSciReq *psReq;
+    unsigned long ulEnd;
+    unsigned long ulCount;
+    unsigned char ucData;
+
+    //ʱͣ֡ڻ
+    while((psRx->ulTail != psRx->ulHead) &&
+          ((psPort->ulReqTail - psPort->ulReqHead) < SCI_REQ_WINDOW))
+    {
+        ulEnd = psRx->pulMark[psRx->ulTail & (SCI_MODBUS_MARK_NUM - 1)];
+        psReq = &psPort->psReq[psPort->ulReqTail % SCI_REQ_WINDOW];
+        ulCount = 0;
+        //֡Ķֽڶ֡ȴ
+        while(((long)(ulEnd - psPort->sRxRing.ulTail) > 0) &&
+              SciRingGet(&psPort->sRxRing, &ucData))
+        {
+            if(ulCount < SCI_RXDATA_MAX)
+            {
+                psReq->pucData[ulCount] = ucData;
+            }
+            ulCount++;
+        }
+        psRx->ulTail++;
+
+        //֡ͬվ֡վӦ𣩼֡
+        if(!SciModbusRxCheck(psReq->pucData, ulCount))
+        {
+            psPort->ulRxResync++;
+        }
+        else if((psReq->pucData[0] != psPort->uiSortNumber) && (psReq->pucData[0] != 0))
+        {
+            psPort->ulStationSkip++;
+        }
+        else
+        {
+            psReq->psCmd = &g_sSciModbusCmd;
+            psReq->uiLength = ulCount;
+            psReq->uiTxn = SCI_TXN_NONE;
+            psReq->uiStation = SCI_STATION_NONE;
+            psPort->ulReqTail++;//
+        }
+    }
+}
+
+static unsigned char *g_pucModbusTxFrame; //ɵӦ֡λڷͶеĿ
+
+//Ӧ𣺵ַճ󣬷ʼλãCheckdata()ȷϷͶп
+static unsigned char *SciModbusTxBegin(void)
+{
+    g_pucModbusTxFrame = SciTxqAlloc(g_psSciPort);
+    g_pucModbusTxFrame[0] = RC_DataBUF[0];
+    g_pucModbusTxFrame[1] = RC_DataBUF[1];
+    return(&g_pucModbusTxFrame[2]);
+}
+
+//ӦɣpucEndΪĩβCRC뷢ͶУ㲥Ӧ
+static void SciModbusTxEnd(unsigned char *pucEnd)
+{
+    unsigned long ulLength = pucEnd - g_pucModbusTxFrame;
+
+    if(RC_DataBUF[0] == 0)
+    {
+        return;
+    }
+    CodecPutU16(pucEnd, CrcModbus(g_pucModbusTxFrame, ulLength));
+    SciTxqPush(g_psSciPort, SCI_TXQ_CTRL, g_pucModbusTxFrame, ulLength + 2, 0);
+}
+
+//쳣Ӧ𣺹λ1쳣
+static void SciModbusException(unsigned int uiCode)
+{
+    unsigned char *pucData = SciModbusTxBegin();
+
+    g_pucModbusTxFrame[1] |= 0x80;
+    *pucData++ = uiCode;
+    SciModbusTxEnd(pucData);
+}
+
+//ĴֵżĴΪĸ16λĴΪ16λ
+static unsigned int SciModbusRegGet(unsigned int uiReg)
+{
+    unsigned char pucValue[4];
+
+    CodecPutFloat(pucValue, Paramet[uiReg >> 1]);
+    return(CodecGetU16(&pucValue[(uiReg & 1) ? 0 : 2]));
+}
+
+//дһpucValueΪ˵Ĵֵ16λǰ
+static void SciModbusParamSet(unsigned int uiIndex, const unsigned char *pucValue)
+{
+    unsigned char pucFloat[4];
+
+    CodecPutU16(&pucFloat[2], CodecGetU16Be(&pucValue[0]));
+    CodecPutU16(&pucFloat[0], CodecGetU16Be(&pucValue[2]));
+    Paramet[uiIndex] = CodecGetFloat(pucFloat);
+    IpcSyncMark(uiIndex);
+}
+
+//дһ룺ݴ浽һ뵽ٸдParamet
+static void SciModbusRegStage(tSciModbusStage *psStage, unsigned int uiReg,
+                              unsigned int uiValue)
+{
+    unsigned int uiIndex = uiReg >> 1;
+
+    if((psStage->uiHalf == 0) || (psStage->uiIndex != uiIndex))
+    {
+        psStage->uiIndex = uiIndex;
+        psStage->uiHalf = 0;
+        CodecPutFloat(psStage->pucValue, Paramet[uiIndex]);
+    }
+    CodecPutU16(&psStage->pucValue[(uiReg & 1) ? 0 : 2], uiValue);
+    psStage->uiHalf |= (uiReg & 1) ? 2 : 1;
+    if(psStage->uiHalf == 3)
+    {
+        Paramet[uiIndex] = CodecGetFloat(psStage->pucValue);
+        IpcSyncMark(uiIndex);
+        psStage->uiHalf = 0;
+    }
+}
+
+//Ĵ3/4ʼַӦΪֽĴֵ
+//uiNumberΪɶĲ
+static void SciModbusRead(unsigned int uiNumber)
+{
+    unsigned int uiStart = CodecGetU16Be(&RC_DataBUF[2]);
+    unsigned int uiCount = CodecGetU16Be(&RC_DataBUF[4]);
+    unsigned char *pucData;
+
+    if((PackLength != 8) || (uiCount == 0) || (uiCount > SCI_MODBUS_READ_MAX))
+    {
+        SciModbusException(SCI_MODBUS_EX_VALUE);
+        return;
+    }
+    if((uiStart + uiCount) > (2 * uiNumber))
+    {
+        SciModbusException(SCI_MODBUS_EX_ADDRESS);
+        return;
+    }
+    pucData = SciModbusTxBegin();
+    *pucData++ = 2 * uiCount;
+    while(uiCount--)
+    {
+        CodecPutU16Be(pucData, SciModbusRegGet(uiStart++));
+        pucData += 2;
+    }
+    SciModbusTxEnd(pucData);
+}
+
+//дĴַΧдParametͬдĲCheckdata()ϳһϢC28
+//ɶԵļĴֱӸдɶԵļĴ˿ڵݴдmodbus.h
+//pucValueΪ˵ļĴֵ쳣룬0ʾɹ
+static unsigned int SciModbusWrite(unsigned int uiStart, unsigned int uiCount,
+                                   const unsigned char *pucValue)
+{
+    tSciModbusStage *psStage = &g_psSciPort->sModbusStage;
+    unsigned int uiFirst = uiStart >> 1;
+    unsigned int uiLast = (uiStart + uiCount - 1) >> 1;
+    unsigned int uiReg;
+    unsigned int i;
+
+    //ʵʱвC28ϴд
+    if((uiFirst < RunParamNumber) || (uiLast >= ParameterNumber))
+    {
+        return(SCI_MODBUS_EX_ADDRESS);
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        uiReg = uiStart + i;
+        if(!(uiReg & 1) && ((i + 1) < uiCount))
+        {
+            //дݴͬһһ
+            if(psStage->uiHalf && (psStage->uiIndex == (uiReg >> 1)))
+            {
+                psStage->uiHalf = 0;
+            }
+            SciModbusParamSet(uiReg >> 1, &pucValue[2 * i]);
+            i++;
+        }
+        else
+        {
+            SciModbusRegStage(psStage, uiReg, CodecGetU16Be(&pucValue[2 * i]));
+        }
+    }
+    return(0);
+}
+
+//дĴ6ֵַӦճ
+static void SciModbusWriteSingle(void)
+{
+    unsigned int uiCode;
+    unsigned char *pucData;
+
+    if(PackLength != 8)
+    {
+        SciModbusException(SCI_MODBUS_EX_VALUE);
+        return;
+    }
+    uiCode = SciModbusWrite(CodecGetU16Be(&RC_DataBUF[2]), 1, &RC_DataBUF[4]);
+    if(uiCode)
+    {
+        SciModbusException(uiCode);
+        return;
+    }
+    pucData = SciModbusTxBegin();
+    memcpy(pucData, &RC_DataBUF[2], 4);
+    SciModbusTxEnd(pucData + 4);
+}
+
+//дĴ16ʼַֽĴֵӦΪʼַ͸
+static void SciModbusWriteMultiple(void)
+{
+    unsigned int uiStart = CodecGetU16Be(&RC_DataBUF[2]);
+    unsigned int uiCount = CodecGetU16Be(&RC_DataBUF[4]);
+    unsigned int uiCode;
+    unsigned char *pucData;
+
+    if((uiCount == 0) || (uiCount > SCI_MODBUS_WRITE_MAX) ||
+       (RC_DataBUF[6] != 2 * uiCount) || (PackLength != (9 + 2 * uiCount)))
+    {
+        SciModbusException(SCI_MODBUS_EX_VALUE);
+        return;
+    }
+    uiCode = SciModbusWrite(uiStart, uiCount, &RC_DataBUF[7]);
+    if(uiCode)
+    {
+        SciModbusException(uiCode);
+        return;
+    }
+    pucData = SciModbusTxBegin();
+    memcpy(pucData, &RC_DataBUF[2], 4);
+    SciModbusTxEnd(pucData + 4);
+}
+
+//ModbusRC_DataBUFΪַ֡ /  /  / CRCPackLengthΪֽ֡
+void SciCmdModbus(void)
+{
+    switch(RC_DataBUF[1])
+    {
+        case 3:
+            SciModbusRead(ParameterNumber);
+            break;
+        case 4:
+            SciModbusRead(RunParamNumber);
+            break;
+        case 6:
+            SciModbusWriteSingle();
+            break;
+        case 16:
+            SciModbusWriteMultiple();
+            break;
+        default:
+            SciModbusException(SCI_MODBUS_EX_FUNCTION);
+            break;
+    }
+}
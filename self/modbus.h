@@ -0,0 +1,50 @@
+#ifndef __MODBUS_H__
+#define __MODBUS_H__
+
+//----------------------------------Modbus RTUվ
+//˿֡ʽΪSCI_FRAMING_MODBUS֡ʽЭ̻˿õϵĬֵʱΪModbus RTUվ
+//վַΪ˿ڵıվţַ0Ϊ㲥ִֻдӦ
+//32λfloatӳ䵽һԼĴ16λǰĴ2n2n+1ӦParamet[n]
+//ּĴ3/6/16ȫֻòRunParamNumber𣩿д
+//Ĵ4ʵʱвParamet[0..RunParamNumber-1]
+//дĴгɶԵļĴֱӸдֻдһĲ616βɶԵļĴ
+//ݴڶ˿Уͬһһ뵽ŸдParametC28ῴ¾ƴɵֵ
+//ݴڼĴԷԭֵÿ˿ֻݴһһİдʱǰݴһ붪
+//һдĲϳһͬϢC28ipc_sync.h
+//֡磺FIFOʣֽʱUART32λʱ䣨8-N-13.2ַûյֽڼճʱжϣ
+//ʱt1.5t3.5֮䣬֡t3.5һжаѴʱջдΪ֡β
+//ѭ֡βȡַ֡֡32λʱʱΪΣCRC
+//t1.532λʱ֮ļʶ𣨲19200ʱt1.5̶Ϊ750us32λʱ䣩
+#define SCI_MODBUS_MARK_NUM 8   //Ѽ¼δ֡βޣ2
+#define SCI_MODBUS_FRAME_MIN 4  //ַ֡++CRC
+#define SCI_MODBUS_READ_MAX 125 //һζĴޣModbus淶
+//һдĴޣ֡9ֽ+ݣҪ
+#define SCI_MODBUS_WRITE_MAX (((SCI_RXDATA_MAX - 9) / 2) & ~1)
+
+#define SCI_MODBUS_EX_FUNCTION 0x01 //쳣룺ֵ֧Ĺ
+#define SCI_MODBUS_EX_ADDRESS  0x02 //쳣룺ĴַǷ򲻿д
+#define SCI_MODBUS_EX_VALUE    0x03 //쳣룺Ĵ֡ȷǷ
+
+//֡β¼ulHeadֻUARTждulTailֻѭд
+typedef struct
+{
+    unsigned long pulMark[SCI_MODBUS_MARK_NUM]; //֡βջд
+    volatile unsigned long ulHead;
+    volatile unsigned long ulTail;
+    unsigned long ulLast;   //¼֡βֻжз
+} tSciModbusRx;
+
+//ֻдһĲֻѭ
+typedef struct
+{
+    unsigned int uiIndex;       //
+    unsigned int uiHalf;        //дһ룺bit016λżַ bit116λ0ʾûݴ
+    unsigned char pucValue[4];  //ֵдһΪֵ
+} tSciModbusStage;
+
+extern void SciModbusRxReset(tSciPort *psPort);
+extern void SciModbusRxMark(tSciPort *psPort);
+extern void SciModbusRxProcess(tSciPort *psPort);
+extern void SciCmdModbus(void);
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ *     report.c
+ *
+ *     仯ϱʵʱв򵽴ﱣʱͣλѯ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "codec.h"
+#include "ipc_snap.h"
+
+//ñ仯ϱ
+void SciCmdReport(void)
+{
+    unsigned int uiFirst = RC_DataBUF[2];
+    unsigned int uiCount = RC_DataBUF[3];
+    float fDeadband = CodecGetFloat(&RC_DataBUF[4]);
+    unsigned long ulMin = CodecGetU16(&RC_DataBUF[8]);
+    unsigned long ulMax = CodecGetU16(&RC_DataBUF[10]);
+    tSciReport *psReport;
+    unsigned int i;
+
+    //ΪNaNСʱ
+    if((uiCount == 0) || (uiFirst + uiCount > RunParamNumber) ||
+       !(fDeadband >= 0) || (ulMax && (ulMin > ulMax)))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    for(i = uiFirst; i < uiFirst + uiCount; i++)
+    {
+        psReport = &g_psSciPort->sReport.psParam[i];
+        psReport->fDeadband = fDeadband;
+        psReport->ulMin = ulMin;
+        psReport->ulMax = ulMax;
+        //ϴϱʱ̼ΪС֮ǰúһδϱǰֵλԴΪֵ
+        psReport->ulLast = g_ulTickMs - ulMin;
+        psReport->uiPending = 1;
+    }
+    SciTxAck(ConfirmCode);
+}
+
+//ֵѸ£IPCdata_tran()еãڸ˿ڷֱϴϱֵȽϣʱȴϱ
+void SciReportUpdate(unsigned int uiIndex)
+{
+    tSciReport *psReport;
+    float fDelta;
+    unsigned int i;
+
+    for(i = 0; i < SCI_PORT_NUM; i++)
+    {
+        psReport = &g_ppsSciPort[i]->sReport.psParam[uiIndex];
+        if(psReport->ulMax == 0)
+        {
+            continue;
+        }
+        fDelta = Paramet[uiIndex] - psReport->fValue;
+        if((fDelta > psReport->fDeadband) || (-fDelta > psReport->fDeadband))
+        {
+            psReport->uiPending = 1;
+        }
+    }
+}
+
+//仯ϱѭеãһ֡пʱѵڵĲϳһ֡뷢Ͷ
+void SciReportProcess(tSciPort *psPort)
+{
+    tSciReportState *psState = &psPort->sReport;
+    unsigned char *pucData = &psState->pucBuf[SCI_LONG_HEAD];
+    unsigned char *pucCount;
+    unsigned long ulNow = g_ulTickMs;
+    unsigned long ulElapsed;
+    unsigned int uiCount = 0;
+    tSciReport *psReport;
+    unsigned int i;
+
+    if(psState->ulQueued)
+    {
+        if(!SciTxqDone(psPort, SCI_TXQ_BULK, psState->ulTicket))
+        {
+            return;
+        }
+        psState->ulQueued = 0;
+    }
+    if(SciTxqCount(psPort, SCI_TXQ_BULK) >= SCI_TXQ_SIZE)
+    {
+        return;
+    }
+
+    *pucData++ = 0;//к
+    *pucData++ = Report_Code;//
+    CodecPutU16(pucData, psState->uiFrame);
+    pucData += 2;
+    CodecPutU16(pucData, g_usIpcSnapSeq);
+    pucData += 2;
+    pucCount = pucData++;
+    for(i = 0; i < RunParamNumber; i++)
+    {
+        psReport = &psState->psParam[i];
+        if(psReport->ulMax == 0)
+        {
+            continue;
+        }
+        ulElapsed = ulNow - psReport->ulLast;
+        if((psReport->uiPending && (ulElapsed >= psReport->ulMin)) ||
+           (ulElapsed >= psReport->ulMax))
+        {
+            *pucData++ = i;
+            CodecPutFloat(pucData, Paramet[i]);
+            pucData += 4;
+            uiCount++;
+            psReport->fValue = Paramet[i];
+            psReport->ulLast = ulNow;
+            psReport->uiPending = 0;
+        }
+    }
+    if(uiCount == 0)
+    {
+        return;
+    }
+    *pucCount = uiCount;
+    psState->uiFrame++;
+    SciTxqPush(psPort, SCI_TXQ_BULK, psState->pucBuf,
+               SciFrameLong(psPort, psState->pucBuf, pucData), &psState->ulTicket);
+    psState->ulQueued = 1;
+}
@@ -0,0 +1,37 @@
+#ifndef __REPORT_H__
+#define __REPORT_H__
+
+//----------------------------------ʵʱв仯ϱ
+//С/ϱϴϱֵı仯ҾϴϱѹСʱϱ
+//仯ʱÿϱһΪλطѯϱ־Ⱥٱ仯Ĳ
+//úϱ˿ڽУÿ˿ֻյԼõĲ
+//ݣʼ /  / (float) / Сms(16λ) / ms(16λ)Ϊ0ʾȡϱ
+//֡Ϊչ֡к0 / =Report_Code / ֡(16λ) / ռ(16λ) /  / ( / ֵ)...
+//ռ֡ͬstream.h
+#define SCI_REPORT_BUF_SIZE (SCI_LONG_HEAD + 7 + 5 * RunParamNumber + 4) //У4ֽ
+
+typedef struct
+{
+    float fDeadband;        //
+    float fValue;           //ϴϱֵ
+    unsigned long ulMin;    //Сϱms
+    unsigned long ulMax;    //ϱms0ʾϱ
+    unsigned long ulLast;   //ϴϱʱ̣ms
+    unsigned int uiPending; //仯ȴϱ
+} tSciReport;
+
+//˿ڵı仯ϱ״̬
+typedef struct
+{
+    tSciReport psParam[RunParamNumber];
+    unsigned char pucBuf[SCI_REPORT_BUF_SIZE]; //֡ͻ
+    unsigned long ulQueued;       //֡ѷ뷢Ͷ
+    unsigned long ulTicket;       //֡ڷͶе
+    unsigned int uiFrame;         //֡λݴ˷ֶ֡
+} tSciReportState;
+
+extern void SciCmdReport(void);
+extern void SciReportUpdate(unsigned int uiIndex);
+extern void SciReportProcess(tSciPort *psPort);
+
+#endif
@@ -0,0 +1,95 @@
+/*
+ *     sci_cache.c
+ *
+ *     ʵʱвĶӦ𻺴棺ָֻ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "codec.h"
+
+//˿ڵǰУ鷽ʽ֡ʽ֮֡ͬʱ
+static unsigned long SciCacheMode(tSciPort *psPort)
+{
+    return(psPort->ulCrcMode | (psPort->ulFraming << 8));
+}
+
+static unsigned long SciCacheValue(unsigned int uiIndex)
+{
+    unsigned char pucValue[4];
+
+    CodecPutFloat(pucValue, Paramet[uiIndex]);
+    return(CodecGetU32(pucValue));
+}
+
+//֡ڷͶ
+static unsigned long SciCacheBusy(tSciPort *psPort, tSciCache *psCache)
+{
+    return(psCache->uiQueued &&
+           !SciTxqDone(psPort, SCI_TXQ_CTRL, psCache->ulTicket));
+}
+
+//ɶӦ֡TXdeal()еĸʽͬ
+static void SciCacheBuild(tSciPort *psPort, unsigned int uiIndex,
+                          unsigned int uiCode)
+{
+    tSciCache *psCache = &psPort->psCache[uiIndex];
+    unsigned char *pucData = &psCache->pucFrame[5];
+
+    pucData[0] = uiIndex;//к
+    pucData[1] = uiCode;//
+    pucData[2] = ConfirmCode;//ȷ
+    CodecPutFloat(&pucData[3], Paramet[uiIndex]);
+    psCache->ulLength = SciFrameShort(psPort, psCache->pucFrame, &pucData[7]);
+    psCache->ulValue = SciCacheValue(uiIndex);
+    psCache->ulMode = SciCacheMode(psPort);
+    psCache->uiCode = uiCode;
+}
+
+//ֵѸ£IPCdata_tran()еã˿ɹ֡ɣ
+//֡ڷͶʱ´ζ
+void SciCacheUpdate(unsigned int uiIndex)
+{
+    tSciPort *psPort;
+    tSciCache *psCache;
+    unsigned int i;
+
+    for(i = 0; i < SCI_PORT_NUM; i++)
+    {
+        psPort = g_ppsSciPort[i];
+        psCache = &psPort->psCache[uiIndex];
+        if(psCache->ulLength && !SciCacheBusy(psPort, psCache))
+        {
+            SciCacheBuild(psPort, uiIndex, psCache->uiCode);
+        }
+    }
+}
+
+//󣺰ѻ֡ͶУ0ʱɵ߰ͨʽӦ
+//Checkdata()ȷϷͶп
+unsigned long SciCacheSend(tSciPort *psPort, unsigned int uiIndex,
+                           unsigned int uiCode)
+{
+    tSciCache *psCache = &psPort->psCache[uiIndex];
+
+    if((psCache->ulLength == 0) || (psCache->uiCode != uiCode) ||
+       (psCache->ulValue != SciCacheValue(uiIndex)) ||
+       (psCache->ulMode != SciCacheMode(psPort)))
+    {
+        //֡ڶʱܸдͬһ֡Զ
+        if(SciCacheBusy(psPort, psCache))
+        {
+            return(0);
+        }
+        SciCacheBuild(psPort, uiIndex, uiCode);
+    }
+    if(!SciTxqPush(psPort, SCI_TXQ_CTRL, psCache->pucFrame, psCache->ulLength,
+                   &psCache->ulTicket))
+    {
+        return(0);
+    }
+    psCache->uiQueued = 1;
+    return(1);
+}
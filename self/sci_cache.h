@@ -0,0 +1,27 @@
+#ifndef __SCI_CACHE_H__
+#define __SCI_CACHE_H__
+
+//----------------------------------ʵʱвӦ𻺴
+//Paramet[0..43]ĶӦ֡ͷݡУ飩棬ֱӰѻ֡ͶУ
+//α븡ͼУ飻IPCdata_tran()ֵֻ仯˵֡
+//֡¼ʱ롢ֵ֡ʽһͬɣ֡ڷͶʱд
+//ÿ˿ڸһ黺֡˿ڵУ鷽ʽ֡ʽ
+#define SCI_CACHE_NUM RunParamNumber //ȫʵʱв
+#define SCI_CACHE_FRAME_MAX 16  //ͨ֡ͷ4+1+кš롢ȷ3+4+У4
+
+typedef struct
+{
+    unsigned char pucFrame[SCI_CACHE_FRAME_MAX];
+    unsigned long ulLength;     //ֽ֡0ʾδ
+    unsigned long ulValue;      //ʱĲֵIEEE754λͣ
+    unsigned long ulMode;       //ʱУ鷽ʽ֡ʽ
+    unsigned long ulTicket;     //һӵ
+    unsigned int uiCode;        //ʱ
+    unsigned int uiQueued;      //ӣ谴ȷѷ
+} tSciCache;
+
+extern void SciCacheUpdate(unsigned int uiIndex);
+extern unsigned long SciCacheSend(tSciPort *psPort, unsigned int uiIndex,
+                                  unsigned int uiCode);
+
+#endif
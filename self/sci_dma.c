@@ -0,0 +1,205 @@
+/*
+ *     sci_dma.c
+ *
+ *     UARTuDMA䣺ʱһν֡ɺUARTж֪ͨ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "hw_uart.h"
+#include "interrupt.h"
+#include "sysctl.h"
+#include "uart.h"
+#include "udma.h"
+
+//uDMAͨƱ1024ֽڶ
+#if defined(ccs)
+#pragma DATA_ALIGN(g_psDmaControlTable, 1024)
+tDMAControlTable g_psDmaControlTable[64];
+#else
+tDMAControlTable g_psDmaControlTable[64] __attribute__ ((aligned(1024)));
+#endif
+
+volatile unsigned long g_ulSciDmaErrCount = 0;    //uDMAߴ˿ڹ
+
+//װһջӻʼд
+static void SciDmaRxArm(tSciPort *psPort, unsigned long ulSel)
+{
+    uDMAChannelTransferSet(psPort->psConfig->ulDmaRx | ulSel, UDMA_MODE_PINGPONG,
+                           (void *)(psPort->psConfig->ulBase + UART_O_DR),
+                           psPort->pucDmaRxBuf[(ulSel == UDMA_ALT_SELECT) ? 1 : 0],
+                           SCI_DMA_RX_SIZE);
+}
+
+//дȺ˳תջװأдulDmaRxNextΪһдĻ
+//жʱܶдתдһ飬ֽ
+static void SciDmaRxDone(tSciPort *psPort)
+{
+    unsigned long ulChannel = psPort->psConfig->ulDmaRx;
+    unsigned long ulSel;
+    unsigned long i;
+
+    for(i = 0; i < 2; i++)
+    {
+        ulSel = psPort->ulDmaRxNext;
+        if(uDMAChannelModeGet(ulChannel | ulSel) != UDMA_MODE_STOP)
+        {
+            break;
+        }
+        SciStationWrite(psPort, psPort->pucDmaRxBuf[(ulSel == UDMA_ALT_SELECT) ? 1 : 0],
+                        SCI_DMA_RX_SIZE);
+        SciDmaRxArm(psPort, ulSel);
+        psPort->ulDmaRxNext = ulSel ^ UDMA_ALT_SELECT;
+    }
+}
+
+//uDMAʼڸ˿ڵSciDmaPortInit()֮ǰһ
+void SciDmaInit(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    IntRegister(INT_UDMAERR, SciDmaErrorIntHandler);
+    IntEnable(INT_UDMAERR);
+    uDMAEnable();
+    uDMAControlBaseSet(g_psDmaControlTable);
+}
+
+//˿ڵշͨʼ
+void SciDmaPortInit(tSciPort *psPort)
+{
+    const tSciPortConfig *psConfig = psPort->psConfig;
+
+    psPort->ulDmaTxBusy = 0;
+    psPort->ulDmaRxNext = UDMA_PRI_SELECT;
+    if(psConfig->ulDmaAlt)
+    {
+        uDMAChannel8_15SelectAltMapping(psConfig->ulDmaAlt);
+    }
+
+    //ֽͨڿȣԴַĿĵַΪUARTݼĴ
+    //FIFOʱÿͻ4ֽ
+    uDMAChannelAttributeDisable(psConfig->ulDmaTx,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_HIGH_PRIORITY |
+                                UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(psConfig->ulDmaTx, UDMA_ATTR_USEBURST);
+    uDMAChannelControlSet(psConfig->ulDmaTx | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE |
+                          UDMA_ARB_4);
+
+    //ͨƹģʽֻͻ󣬴Ⱥͻȼsci_dma.h
+    uDMAChannelAttributeDisable(psConfig->ulDmaRx,
+                                UDMA_ATTR_ALTSELECT | UDMA_ATTR_HIGH_PRIORITY |
+                                UDMA_ATTR_REQMASK);
+    uDMAChannelAttributeEnable(psConfig->ulDmaRx, UDMA_ATTR_USEBURST);
+    uDMAChannelControlSet(psConfig->ulDmaRx | UDMA_PRI_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 |
+                          SCI_DMA_RX_ARB);
+    uDMAChannelControlSet(psConfig->ulDmaRx | UDMA_ALT_SELECT,
+                          UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 |
+                          SCI_DMA_RX_ARB);
+    SciDmaRxArm(psPort, UDMA_PRI_SELECT);
+    SciDmaRxArm(psPort, UDMA_ALT_SELECT);
+    uDMAChannelEnable(psConfig->ulDmaRx);
+
+    UARTDMAEnable(psConfig->ulBase, UART_DMA_TX | UART_DMA_RX);
+}
+
+//һ֡ͣͨæ򳤶ȷǷʱ0÷´
+//æ־֮ͨ䲻ܽUARTжϣSciDmaTxIsr()æ־ͨδ򿪣ᵱ
+unsigned long SciDmaSend(tSciPort *psPort, const unsigned char *pucBuf,
+                         unsigned long ulCount)
+{
+    tBoolean bMasked;
+
+    if(psPort->ulDmaTxBusy || (ulCount == 0) || (ulCount > SCI_DMA_TX_MAX))
+    {
+        return(0);
+    }
+    bMasked = IntMasterDisable();
+    psPort->ulDmaTxBusy = 1;
+    uDMAChannelTransferSet(psPort->psConfig->ulDmaTx | UDMA_PRI_SELECT,
+                           UDMA_MODE_BASIC, (void *)pucBuf,
+                           (void *)(psPort->psConfig->ulBase + UART_O_DR), ulCount);
+    uDMAChannelEnable(psPort->psConfig->ulDmaTx);
+    if(!bMasked)
+    {
+        IntMasterEnable();
+    }
+    return(1);
+}
+
+unsigned long SciDmaTxBusy(tSciPort *psPort)
+{
+    return(psPort->ulDmaTxBusy);
+}
+
+//UARTжеãuDMAͨԶر
+void SciDmaTxIsr(tSciPort *psPort)
+{
+    if(psPort->ulDmaTxBusy && !uDMAChannelIsEnabled(psPort->psConfig->ulDmaTx))
+    {
+        psPort->ulDmaTxBusy = 0;
+    }
+}
+
+//UARTжеãתдĽջճʱʱرյǰ
+void SciDmaRxIsr(tSciPort *psPort, unsigned long ulStatus)
+{
+    unsigned long ulChannel = psPort->psConfig->ulDmaRx;
+    unsigned long ulSel;
+    unsigned long ulCount;
+
+    SciDmaRxDone(psPort);
+
+    if(ulStatus & UART_INT_RT)
+    {
+        //ճʱʱFIFOеֽڲͻȣuDMAͬʱ
+        uDMAChannelDisable(ulChannel);
+        //֮󡢹ر֮ͨǰдһ
+        SciDmaRxDone(psPort);
+        ulSel = psPort->ulDmaRxNext;
+        ulCount = SCI_DMA_RX_SIZE - uDMAChannelSizeGet(ulChannel | ulSel);
+        if(ulCount)
+        {
+            SciStationWrite(psPort,
+                            psPort->pucDmaRxBuf[(ulSel == UDMA_ALT_SELECT) ? 1 : 0],
+                            ulCount);
+            //װغһһдĻ
+            SciDmaRxArm(psPort, ulSel);
+        }
+        //FIFOʣֽڻ֮
+        SciStationDrain(psPort);
+        uDMAChannelEnable(ulChannel);
+        //ճʱΪModbus RTU֡
+        if(psPort->ulFraming == SCI_FRAMING_MODBUS)
+        {
+            SciModbusRxMark(psPort);
+        }
+    }
+    else if(!uDMAChannelIsEnabled(ulChannel))
+    {
+        //鶼дʱֹͨͣװأ´
+        uDMAChannelEnable(ulChannel);
+    }
+}
+
+//uDMAߴжϣ޷жϳͨ˿ڽеķȫϣͷŷͨ
+void SciDmaErrorIntHandler(void)
+{
+    unsigned long i;
+
+    if(uDMAErrorStatusGet())
+    {
+        uDMAErrorStatusClear();
+        g_ulSciDmaErrCount++;
+        for(i = 0; i < SCI_PORT_NUM; i++)
+        {
+            uDMAChannelDisable(g_ppsSciPort[i]->psConfig->ulDmaTx);
+            g_ppsSciPort[i]->ulDmaTxBusy = 0;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef __SCI_DMA_H__
+#define __SCI_DMA_H__
+
+#include "sci_ring.h"
+
+//----------------------------------UART uDMA
+//֡uDMA˵UARTFIFO͹CPUֽڴ
+//uDMAɺ󴥷UARTжϣSciDmaTxIsr()æ־
+#define SCI_DMA_TX_MAX 1024 //uDMAֽ
+
+//----------------------------------UART uDMAƹҽ
+//ջʹãдһ鼴תջλ
+//uDMAֻFIFOﵽʱͻˣ֡β㴥ȵֽFIFOУ
+//ɽճʱж(UART_INT_RT)رյǰͬFIFOʣֽһת
+//ͻȱСڴȣ֡βFIFOʣֽڣÿ֡ʱճʱжϣ
+//ʱΪ8ı֡8ֽڵĶȫͻߣFIFOΪգճʱ
+//֡ͣƹһֱһ
+//˿ʹԼһͨͻͨż˿
+#define SCI_DMA_RX_SIZE 64  //ջ
+#define SCI_DMA_RX_FIFO UART_FIFO_RX6_8 //FIFOﵽ3/4(12ֽ)ʱuDMA
+#define SCI_DMA_RX_ARB UDMA_ARB_8       //ÿͻ8ֽڣFIFO4ֽ
+
+extern volatile unsigned long g_ulSciDmaErrCount;
+
+extern void SciDmaInit(void);
+extern void SciDmaPortInit(tSciPort *psPort);
+extern unsigned long SciDmaSend(tSciPort *psPort, const unsigned char *pucBuf,
+                                unsigned long ulCount);
+extern unsigned long SciDmaTxBusy(tSciPort *psPort);
+extern void SciDmaTxIsr(tSciPort *psPort);
+extern void SciDmaRxIsr(tSciPort *psPort, unsigned long ulStatus);
+extern void SciDmaErrorIntHandler(void);
+
+#endif
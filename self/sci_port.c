@@ -0,0 +1,188 @@
+/*
+ *     sci_port.c
+ *
+ *     SCIЭ˿ڣUART0/UART1/UART2һ׶Э飬ͬʱӶλ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "hw_ints.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "gpio.h"
+#include "interrupt.h"
+#include "ram.h"
+#include "sysctl.h"
+#include "uart.h"
+#include "udma.h"
+
+//˿ӲãUART1ΪԭеRS485ӣPD2/PD3PD4Ϊʹܣ
+//UART0PE4/PE5UART2PG0/PG1ΪԵӣUART2ʹuDMAͨ12/13ĵڶ
+//UART2ϵ缴ΪModbus RTUվSCADAҪЭת˿ϵΪFE֡ʽ
+static const tSciPortConfig g_psSciPortConfig[SCI_PORT_NUM] =
+{
+    {
+        UART0_BASE, SYSCTL_PERIPH_UART0, INT_UART0, UART0IntHandler,
+        SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_4 | GPIO_PIN_5,
+        GPIO_PE4_U0RX, GPIO_PE5_U0TX,
+        UDMA_CHANNEL_UART0RX, UDMA_CHANNEL_UART0TX, 0,
+        0, 0, 0,
+        SCI_FRAMING_FE
+    },
+    {
+        UART1_BASE, SYSCTL_PERIPH_UART1, INT_UART1, UART1IntHandler,
+        SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_2 | GPIO_PIN_3,
+        GPIO_PD2_U1RX, GPIO_PD3_U1TX,
+        UDMA_CHANNEL_UART1RX, UDMA_CHANNEL_UART1TX, 0,
+        SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_4,
+        SCI_FRAMING_FE
+    },
+    {
+        UART2_BASE, SYSCTL_PERIPH_UART2, INT_UART2, UART2IntHandler,
+        SYSCTL_PERIPH_GPIOG, GPIO_PORTG_BASE, GPIO_PIN_0 | GPIO_PIN_1,
+        GPIO_PG0_U2RX, GPIO_PG1_U2TX,
+        UDMA_SEC_CHANNEL_UART2RX_12, UDMA_SEC_CHANNEL_UART2TX_13,
+        UDMA_CHAN12_SEC_UART2RX | UDMA_CHAN13_SEC_UART2TX,
+        0, 0, 0,
+        SCI_FRAMING_MODBUS
+    },
+};
+
+//˿ʵÿʵһ鹲RAM
+#if defined(ccs)
+#pragma DATA_SECTION(g_sSciPort0, "SHARERAMS5")
+#pragma DATA_SECTION(g_sSciPort1, "SHARERAMS6")
+#pragma DATA_SECTION(g_sSciPort2, "SHARERAMS7")
+static tSciPort g_sSciPort0;
+static tSciPort g_sSciPort1;
+static tSciPort g_sSciPort2;
+#else
+static tSciPort g_sSciPort0 __attribute__ ((section("SHARERAMS5")));
+static tSciPort g_sSciPort1 __attribute__ ((section("SHARERAMS6")));
+static tSciPort g_sSciPort2 __attribute__ ((section("SHARERAMS7")));
+#endif
+
+tSciPort *const g_ppsSciPort[SCI_PORT_NUM] =
+{
+    &g_sSciPort0, &g_sSciPort1, &g_sSciPort2
+};
+
+tSciPort *g_psSciPort = &g_sSciPort1;//ڴĶ˿
+
+//˿ڳʼšUARTϵĬϲʣ8-N-1uDMAж
+//SciCmdInit()CrcInit()SciDmaInit()֮
+void SciPortInit(void)
+{
+    const tSciPortConfig *psConfig;
+    tSciPort *psPort;
+    unsigned long i;
+
+    //ʵڵĹRAMM3C28ʹS5~S7ipc_block.h
+    RAMMReqSharedMemAccess(S5_ACCESS | S6_ACCESS | S7_ACCESS, SX_M3MASTER);
+
+    for(i = 0; i < SCI_PORT_NUM; i++)
+    {
+        psPort = g_ppsSciPort[i];
+        psConfig = &g_psSciPortConfig[i];
+        memset(psPort, 0, sizeof(tSciPort));
+        psPort->psConfig = psConfig;
+
+        SysCtlPeripheralEnable(psConfig->ulPeriph);
+        SysCtlPeripheralEnable(psConfig->ulGpioPeriph);
+        GPIOPinConfigure(psConfig->ulRxPinConfig);
+        GPIOPinConfigure(psConfig->ulTxPinConfig);
+        GPIOPinTypeUART(psConfig->ulGpioBase, psConfig->ulGpioPins);
+
+        SciRxInit(psPort);
+        SciBaudSet(psPort, SCI_BAUD_DEFAULT);
+        //FIFOȱuDMAͻ(sci_dma.h)ÿ֡ʱŶճʱжϣ
+        //Modbus RTUҲж֡
+        UARTFIFOLevelSet(psConfig->ulBase, UART_FIFO_TX4_8, SCI_DMA_RX_FIFO);
+        SciTxqInit(psPort);
+        SciDmaPortInit(psPort);
+        SciStationInit(psPort);
+
+        //uDMAˣCPUֻճʱ·
+        IntRegister(psConfig->ulInt, psConfig->pfnIntHandler);
+        IntEnable(psConfig->ulInt);
+        UARTIntEnable(psConfig->ulBase, UART_INT_RT | UART_INT_OE | UART_INT_FE);
+    }
+}
+
+//˿ڴѭеã˿աͷͣÿÿ˿ദһ
+void SciPortProcess(void)
+{
+    tSciPort *psPort;
+    unsigned long i;
+
+    for(i = 0; i < SCI_PORT_NUM; i++)
+    {
+        psPort = g_ppsSciPort[i];
+        SciRxProcess(psPort);
+        Checkdata(psPort);
+        SciTxqProcess(psPort);
+        SciBaudProcess(psPort);
+        //ModbusվֻӦ𣬲
+        if(psPort->ulFraming != SCI_FRAMING_MODBUS)
+        {
+            SciStreamProcess(psPort);
+            SciReportProcess(psPort);
+        }
+    }
+}
+
+//UARTжϴ
+static void SciPortIntHandler(tSciPort *psPort)
+{
+    unsigned long ulBase = psPort->psConfig->ulBase;
+    unsigned long ulStatus;
+    unsigned long ulError;
+
+    //ȡж״̬
+    ulStatus = UARTIntStatus(ulBase, true);
+
+    //Ѳж
+    UARTIntClear(ulBase, ulStatus);
+
+    //ͳƽ·
+    ulError = UARTRxErrorGet(ulBase);
+    if(ulError)
+    {
+        if(ulError & UART_RXERROR_OVERRUN)
+        {
+            psPort->ulRxOverrun++;
+        }
+        if(ulError & UART_RXERROR_FRAMING)
+        {
+            psPort->ulRxFraming++;
+        }
+        UARTRxErrorClear(ulBase);
+    }
+
+    //дuDMAת뻷λճʱʱͬδĻFIFOʣֽһת
+    //֡ѭSciRxProcess()
+    SciDmaRxIsr(psPort, ulStatus);
+
+    //uDMAҲUARTж
+    SciDmaTxIsr(psPort);
+
+    //ͽһֹͣλƳλĴͷRS485
+    SciStationTxIsr(psPort, ulStatus);
+}
+
+void UART0IntHandler(void)
+{
+    SciPortIntHandler(&g_sSciPort0);
+}
+
+void UART1IntHandler(void)
+{
+    SciPortIntHandler(&g_sSciPort1);
+}
+
+void UART2IntHandler(void)
+{
+    SciPortIntHandler(&g_sSciPort2);
+}
@@ -0,0 +1,126 @@
+#ifndef __SCI_PORT_H__
+#define __SCI_PORT_H__
+
+#include "sci_ring.h"
+#include "sci_dma.h"
+#include "sci_txq.h"
+#include "sci_station.h"
+#include "cobs.h"
+#include "stream.h"
+#include "report.h"
+#include "sci_cache.h"
+#include "modbus.h"
+
+//----------------------------------SCIЭ˿
+//ÿUARTһ˿ʵջСͶСЭ̵Ĳ/У/֡ʽվš
+//ͱ仯ϱȫЭ״̬ʵУ˿ڻӰ죬ͬʱӶλ
+//˻桢¼ǡPCѭи˿һ˿ڵƳ˿ڵӦ
+//ͨg_psSciPortڴĶ˿
+//ÿʵһ鹲RAMУS5~S7M3ΪC0ŲʵҹRAMuDMAʣ
+//S5~S7˲ٹC28ʹãipc_block.hеĹRAMļ
+#define SCI_PORT_NUM 3
+#define SCI_PORT_UART0 0
+#define SCI_PORT_UART1 1    //ԭеRS485ӣPSO֡Ӵ˶˿ڷ
+#define SCI_PORT_UART2 2
+
+#define SCI_RX_RAW_MAX (SCI_HEAD_END + SCI_RXDATA_MAX) //һֽ֡
+
+//˿Ӳ
+typedef struct
+{
+    unsigned long ulBase;        //UARTַ
+    unsigned long ulPeriph;      //UART
+    unsigned long ulInt;         //UARTжϺ
+    void (*pfnIntHandler)(void); //UARTжϴ
+    unsigned long ulGpioPeriph;  //RX/TXڵGPIO
+    unsigned long ulGpioBase;    //RX/TXڵGPIO˿
+    unsigned long ulGpioPins;    //RX/TX
+    unsigned long ulRxPinConfig; //RXŸ
+    unsigned long ulTxPinConfig; //TXŸ
+    unsigned long ulDmaRx;       //uDMAͨ
+    unsigned long ulDmaTx;       //uDMAͨ
+    unsigned long ulDmaAlt;      //uDMAͨ8~15ĵڶѡ0ʾʹĬ
+    unsigned long ulDePeriph;    //RS485ʹ(DE)ڵGPIO
+    unsigned long ulDeBase;      //RS485ʹڵGPIO˿ڣ0ʾԵ
+    unsigned long ulDePin;       //RS485ʹ
+    unsigned long ulFraming;     //ϵĬ֡ʽ
+} tSciPortConfig;
+
+struct tSciPortS
+{
+    const tSciPortConfig *psConfig;
+
+    //գuDMAƹһ -> վŹ -> λUARTжУ
+    unsigned char pucDmaRxBuf[2][SCI_DMA_RX_SIZE];
+    unsigned long ulDmaRxNext;    //һдĻUDMA_PRI_SELECTUDMA_ALT_SELECT
+    tSciStationFilter sFilter;
+    tSciRing sRxRing;
+
+    //֡ѭУSciRxByte()
+    unsigned char pucRxRaw[SCI_RX_RAW_MAX];  //ǰ֡յԭʼֽ
+    unsigned long ulRxRawCount;
+    unsigned char pucRxPend[SCI_RX_RAW_MAX]; //½ֽڣڻλ
+    unsigned long ulRxPendHead;
+    unsigned long ulRxPendTail;
+    unsigned long ulRxTime;       //յֽڵʱ̣ms
+    tCobsDecoder sRxCobs;         //COBS֡룬деĿ
+    tSciModbusRx sModbus;         //Modbus RTU֡β
+    tSciModbusStage sModbusStage; //ModbusֻдһĲ
+    unsigned int uiRxCount;       //֡ڽռͷչ֡ͷ
+    unsigned int uiRxDataCount;   //ռ
+    unsigned int uiRxSum;         //У
+    unsigned long ulRxCrc;
+    unsigned int uiRxLength;      //ڽյ֡İ
+    unsigned int uiRxFlags;       //ڽյ֡չ֡־
+    unsigned int uiRxTxn;         //ڽյ֡
+    unsigned int uiRxStation;     //ڽյ֡վ
+    unsigned char *pucRxBuf;      //ڽյ֡ݣָеĿ
+    const tSciCmd *psRxCmd;       //ڽյ֡Ӧ
+
+    //УulReqHeadCheckdata()ulReqTailһ֡д
+    tSciReq psReq[SCI_REQ_WINDOW];
+    unsigned long ulReqHead;
+    unsigned long ulReqTail;
+
+    //
+    volatile unsigned long ulDmaTxBusy; //uDMAͽ
+    tSciTxq psTxq[SCI_TXQ_CLASSES];
+    tSciTxq *psTxqSending;        //֡ѽuDMAĶУ0ʾ
+    tSciTxStats psTxStats[SCI_TXQ_CLASSES];
+    unsigned char pucTxPool[SCI_TXQ_SIZE][SCI_TXBUF_SIZE]; //еnʹõn黺
+
+    //Э̵ͨѶ
+    unsigned long ulBaud;         //ǰ
+    unsigned long ulBaudNew;      //Э̵õ²
+    unsigned long ulBaudOld;      //лǰĲʣʱָ
+    unsigned long ulBaudState;    //Э״̬
+    unsigned long ulBaudTime;     //лʱ̣ms
+    unsigned long ulCrcMode;      //֡У鷽ʽcrc.h
+    unsigned int uiTrailer;       //֡βУֽ
+    unsigned long ulFraming;      //֡ʽSCI_FRAMING_FESCI_FRAMING_COBSSCI_FRAMING_MODBUS
+    unsigned int uiSortNumber;    //վ
+    unsigned long ulRxTimeout;    //ֽڼʱʱ䣬ms
+
+    //ͳ
+    volatile unsigned long ulRxOverrun;  //
+    volatile unsigned long ulRxFraming;  //֡
+    volatile unsigned long ulStationSkip; //վ֡
+    unsigned long ulRxResync;     //֡ѰҰͷĴ
+    unsigned long ulRxTimeouts;   //ֽڼʱ֡
+
+    //
+    tSciStreamState sStream;
+    tSciReportState sReport;
+    tSciCache psCache[SCI_CACHE_NUM];
+};
+
+extern tSciPort *const g_ppsSciPort[SCI_PORT_NUM];
+extern tSciPort *g_psSciPort;//ڴĶ˿
+
+extern void SciPortInit(void);
+extern void SciPortProcess(void);
+extern void UART0IntHandler(void);
+extern void UART1IntHandler(void);
+extern void UART2IntHandler(void);
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ *     sci_ring.c
+ *
+ *     UARTջλжֻֽڣ֡ѭ
+ *
+ *
+ */
+
+#include "sci_ring.h"
+
+void SciRingInit(tSciRing *psRing)
+{
+    psRing->ulHead = 0;
+    psRing->ulTail = 0;
+    psRing->ulDrop = 0;
+}
+
+//δȡֽ
+unsigned long SciRingCount(tSciRing *psRing)
+{
+    return(psRing->ulHead - psRing->ulTail);
+}
+
+//дһֽڣжеã0
+unsigned long SciRingPut(tSciRing *psRing, unsigned char ucData)
+{
+    unsigned long ulHead = psRing->ulHead;
+
+    if((ulHead - psRing->ulTail) >= SCI_RING_SIZE)
+    {
+        psRing->ulDrop++;
+        return(0);
+    }
+    psRing->pucBuf[ulHead & SCI_RING_MASK] = ucData;
+    //дٷдѭulHeadʱһѾЧ
+    psRing->ulHead = ulHead + 1;
+    return(1);
+}
+
+//ɿд루жеãŲµֽڼulDrop
+void SciRingWrite(tSciRing *psRing, const unsigned char *pucData,
+                  unsigned long ulCount)
+{
+    unsigned long ulHead = psRing->ulHead;
+    unsigned long ulFree = SCI_RING_SIZE - (ulHead - psRing->ulTail);
+
+    if(ulCount > ulFree)
+    {
+        psRing->ulDrop += ulCount - ulFree;
+        ulCount = ulFree;
+    }
+    while(ulCount--)
+    {
+        psRing->pucBuf[ulHead & SCI_RING_MASK] = *pucData++;
+        ulHead++;
+    }
+    psRing->ulHead = ulHead;
+}
+
+//һֽڣѭеãշ0
+unsigned long SciRingGet(tSciRing *psRing, unsigned char *pucData)
+{
+    unsigned long ulTail = psRing->ulTail;
+
+    if(ulTail == psRing->ulHead)
+    {
+        return(0);
+    }
+    *pucData = psRing->pucBuf[ulTail & SCI_RING_MASK];
+    psRing->ulTail = ulTail + 1;
+    return(1);
+}
+
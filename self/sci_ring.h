@@ -0,0 +1,25 @@
+#ifndef __SCI_RING_H__
+#define __SCI_RING_H__
+
+//----------------------------------SCIջλ
+//(UARTж)/(ѭ)
+//ulHeadֻждulTailֻѭд߾ΪɼֵΪֽ
+#define SCI_RING_SIZE 256   //ȣΪ2
+#define SCI_RING_MASK (SCI_RING_SIZE-1)
+
+typedef struct
+{
+    volatile unsigned long ulHead;   //дߣ
+    volatile unsigned long ulTail;   //ߣ
+    volatile unsigned long ulDrop;   //ʱֽ
+    unsigned char pucBuf[SCI_RING_SIZE];
+} tSciRing;
+
+extern void SciRingInit(tSciRing *psRing);
+extern unsigned long SciRingCount(tSciRing *psRing);
+extern unsigned long SciRingPut(tSciRing *psRing, unsigned char ucData);
+extern void SciRingWrite(tSciRing *psRing, const unsigned char *pucData,
+                         unsigned long ulCount);
+extern unsigned long SciRingGet(tSciRing *psRing, unsigned char *pucData);
+
+#endif
@@ -0,0 +1,214 @@
+/*
+ *     sci_station.c
+ *
+ *     RS485ͨѶжаվŹˣͽжлշ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "gpio.h"
+#include "sysctl.h"
+#include "uart.h"
+
+void SciStationInit(tSciPort *psPort)
+{
+    const tSciPortConfig *psConfig = psPort->psConfig;
+    tSciStationFilter *psFilter = &psPort->sFilter;
+
+    psFilter->ulCount = 0;
+    psFilter->ulPass = 0;
+    psFilter->ulSkip = 0;
+    psPort->ulStationSkip = 0;
+    if(psConfig->ulDeBase)
+    {
+        SysCtlPeripheralEnable(psConfig->ulDePeriph);
+        GPIOPinTypeGPIOOutput(psConfig->ulDeBase, psConfig->ulDePin);
+        GPIOPinWrite(psConfig->ulDeBase, psConfig->ulDePin, 0);//ʹ
+    }
+
+    //жλĴһλ
+    UARTTxIntModeSet(psConfig->ulBase, UART_TXINT_MODE_EOT);
+}
+
+//֡ͷ꣬ݴֽڷ뻺ulPassֱֽӷ
+static void SciStationAccept(tSciPort *psPort, unsigned long ulPass)
+{
+    tSciStationFilter *psFilter = &psPort->sFilter;
+
+    SciRingWrite(&psPort->sRxRing, psFilter->pucHold, psFilter->ulCount);
+    psFilter->ulCount = 0;
+    psFilter->ulPass = ulPass;
+}
+
+//֡ͷϷݴֽڣӵǰֽѰҰͷ
+static void SciStationHunt(tSciPort *psPort, unsigned char ucData)
+{
+    tSciStationFilter *psFilter = &psPort->sFilter;
+
+    psFilter->ulCount = 0;
+    if(ucData == PackHead)
+    {
+        psFilter->pucHold[psFilter->ulCount++] = ucData;
+    }
+}
+
+//ǷSciRxByte()ܵķΧڣУ룩
+static unsigned long SciStationLengthOk(tSciPort *psPort, unsigned long ulLength)
+{
+    return((ulLength >= (SCI_PACK_MIN + psPort->uiTrailer - 1)) &&
+           (ulLength <= SCI_RXDATA_MAX));
+}
+
+static void SciStationByte(tSciPort *psPort, unsigned char ucData)
+{
+    tSciStationFilter *psFilter = &psPort->sFilter;
+    unsigned long ulTxn;
+
+    //COBS֡վţҲܰFEͷʶԭ뻺Modbus֡ѭаַ
+    if(psPort->ulFraming != SCI_FRAMING_FE)
+    {
+        SciRingPut(&psPort->sRxRing, ucData);
+        return;
+    }
+    if(psFilter->ulSkip)
+    {
+        psFilter->ulSkip--;
+        return;
+    }
+    if(psFilter->ulPass)
+    {
+        psFilter->ulPass--;
+        SciRingPut(&psPort->sRxRing, ucData);
+        return;
+    }
+
+    if(psFilter->ulCount < PackHeadLength)
+    {
+        //ͷֽSciRecieve()Ҳᶪ˴ֱӶ
+        if(ucData == PackHead)
+        {
+            psFilter->pucHold[psFilter->ulCount++] = ucData;
+        }
+        else
+        {
+            psFilter->ulCount = 0;
+        }
+        return;
+    }
+
+    //ͷFEǰFEǸŻһ֡Ĳ࣬԰ͷ
+    if((psFilter->ulCount == PackHeadLength) && (ucData == PackHead))
+    {
+        return;
+    }
+
+    psFilter->pucHold[psFilter->ulCount++] = ucData;
+    if(psFilter->ulCount == PackHeadLength + 1)//չ֡־
+    {
+        if(ucData != SCI_LONG_FRAME)
+        {
+            if(SciStationLengthOk(psPort, ucData))
+            {
+                SciStationAccept(psPort, ucData);
+            }
+            else
+            {
+                SciStationHunt(psPort, ucData);
+            }
+        }
+        return;
+    }
+    if(psFilter->ulCount == PackHeadLength + 2)//־δλʱѰҰͷ
+    {
+        if(ucData & ~SCI_FLAG_MASK)
+        {
+            SciStationHunt(psPort, ucData);
+            return;
+        }
+        psFilter->ulFlags = ucData;
+        return;
+    }
+    if(psFilter->ulCount == PackHeadLength + 3)//ֽ
+    {
+        psFilter->ulLength = ucData;
+        return;
+    }
+
+    ulTxn = (psFilter->ulFlags & SCI_FLAG_TXN) ? 1 : 0;
+    if(psFilter->ulCount == PackHeadLength + 4)//ֽ
+    {
+        psFilter->ulLength |= (unsigned long)ucData << 8;
+        if(!SciStationLengthOk(psPort, psFilter->ulLength))
+        {
+            SciStationHunt(psPort, ucData);
+        }
+        else if(!(psFilter->ulFlags & SCI_FLAG_STATION))
+        {
+            SciStationAccept(psPort, psFilter->ulLength + ulTxn);
+        }
+        return;
+    }
+
+    //վ
+    if((ucData == psPort->uiSortNumber) || (ucData == SCI_STATION_BROADCAST))
+    {
+        SciStationAccept(psPort, psFilter->ulLength + ulTxn);
+    }
+    else
+    {
+        psFilter->ulCount = 0;
+        psFilter->ulSkip = psFilter->ulLength + ulTxn;
+        psPort->ulStationSkip++;
+    }
+}
+
+//ɿдջUARTжеãվ֡д
+void SciStationWrite(tSciPort *psPort, const unsigned char *pucData,
+                     unsigned long ulCount)
+{
+    while(ulCount--)
+    {
+        SciStationByte(psPort, *pucData++);
+    }
+}
+
+//UARTFIFOеȫֽھ˰뻺RTжеã
+void SciStationDrain(tSciPort *psPort)
+{
+    unsigned long ulBase = psPort->psConfig->ulBase;
+
+    while(UARTCharsAvail(ulBase))
+    {
+        SciStationByte(psPort, UARTCharGetNonBlocking(ulBase));
+    }
+}
+
+//Ϳʼǰ򿪷ʹܣͽж
+void SciStationTxStart(tSciPort *psPort)
+{
+    const tSciPortConfig *psConfig = psPort->psConfig;
+
+    if(psConfig->ulDeBase)
+    {
+        GPIOPinWrite(psConfig->ulDeBase, psConfig->ulDePin, psConfig->ulDePin);//ʹ
+        UARTIntEnable(psConfig->ulBase, UART_INT_TX);
+    }
+}
+
+//UARTжеã֡Ϻرշʹܣͷ
+//uDMAFIFOʱҲܲͽжϣʱͨڹл
+void SciStationTxIsr(tSciPort *psPort, unsigned long ulStatus)
+{
+    const tSciPortConfig *psConfig = psPort->psConfig;
+
+    if((ulStatus & UART_INT_TX) && !SciDmaTxBusy(psPort) &&
+       !UARTBusy(psConfig->ulBase))
+    {
+        GPIOPinWrite(psConfig->ulDeBase, psConfig->ulDePin, 0);//ʹ
+        UARTIntDisable(psConfig->ulBase, UART_INT_TX);
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef __SCI_STATION_H__
+#define __SCI_STATION_H__
+
+#include "sci_ring.h"
+
+//----------------------------------RS485ͨѶ
+//չ֡־SCI_FLAG_STATIONλʱ1ֽվţֻվŵڶ˿ڵıվ
+//㲥վŵ֡Žջλվ֡UARTжа֡
+//У飻վŵ֡ճգԵӣ
+//㲥֡Ӧ𣻴վŵԴվŵչ֡Ӧ
+//ʹ(DE)ǰλUARTͽж(EOT)㣻˿ûDEʱΪԵ
+
+//״ֻ̬ڶ˿ڵUARTжз
+//ֻʶͷ־վţУ飻Χ־δλʱٰ
+//֡лӸֽѰҰͷͷFEΪͷ
+typedef struct
+{
+    unsigned char pucHold[SCI_LONG_HEAD + 1]; //վȷǰݴ֡ͷ
+    unsigned long ulCount;         //ݴ֡ͷֽ
+    unsigned long ulFlags;         //չ֡־
+    unsigned long ulLength;        //
+    unsigned long ulPass;          //֡뻺ֽ
+    unsigned long ulSkip;          //ֽ֡
+} tSciStationFilter;
+
+extern void SciStationInit(tSciPort *psPort);
+extern void SciStationWrite(tSciPort *psPort, const unsigned char *pucData,
+                            unsigned long ulCount);
+extern void SciStationDrain(tSciPort *psPort);
+extern void SciStationTxStart(tSciPort *psPort);
+extern void SciStationTxIsr(tSciPort *psPort, unsigned long ulStatus);
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ *     sci_txq.c
+ *
+ *     SCIͶУա뷢ͷ룬շͬʱУӦݷ
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "hw_types.h"
+#include "interrupt.h"
+
+void SciTxqInit(tSciPort *psPort)
+{
+    unsigned long i;
+
+    for(i = 0; i < SCI_TXQ_CLASSES; i++)
+    {
+        psPort->psTxq[i].ulHead = 0;
+        psPort->psTxq[i].ulTail = 0;
+    }
+    psPort->psTxqSending = 0;
+}
+
+//δ֡ڷ͵֡
+unsigned long SciTxqCount(tSciPort *psPort, unsigned long ulClass)
+{
+    return(psPort->psTxq[ulClass].ulTail - psPort->psTxq[ulClass].ulHead);
+}
+
+//ȡÿһĻ棬0֡SciTxqPush()
+unsigned char *SciTxqAlloc(tSciPort *psPort)
+{
+    if(SciTxqCount(psPort, SCI_TXQ_CTRL) >= SCI_TXQ_SIZE)
+    {
+        return(0);
+    }
+    return(psPort->pucTxPool[psPort->psTxq[SCI_TXQ_CTRL].ulTail & SCI_TXQ_MASK]);
+}
+
+//֡ӣ0pulTicket0ʱظ֡ţSciTxqDone()ѯǷ
+unsigned long SciTxqPush(tSciPort *psPort, unsigned long ulClass,
+                         const unsigned char *pucFrame,
+                         unsigned long ulLength, unsigned long *pulTicket)
+{
+    tSciTxq *psTxq = &psPort->psTxq[ulClass];
+    tSciTxFrame *psFrame;
+
+    if(SciTxqCount(psPort, ulClass) >= SCI_TXQ_SIZE)
+    {
+        return(0);
+    }
+    psFrame = &psTxq->psFrame[psTxq->ulTail & SCI_TXQ_MASK];
+    psFrame->pucFrame = pucFrame;
+    psFrame->ulLength = ulLength;
+    psFrame->ulTime = g_ulTickMs;
+    psTxq->ulTail++;
+    if(pulTicket)
+    {
+        *pulTicket = psTxq->ulTail;
+    }
+    return(1);
+}
+
+//ΪulTicket֡ѷϣͷԸд仺
+unsigned long SciTxqDone(tSciPort *psPort, unsigned long ulClass,
+                         unsigned long ulTicket)
+{
+    return((long)(psPort->psTxq[ulClass].ulHead - ulTicket) >= 0);
+}
+
+//ӦȫUARTûڷ͵֡UART FIFOпܻݣ
+//֡Ŷӣлصȴ
+unsigned long SciTxqIdle(tSciPort *psPort)
+{
+    return((psPort->psTxqSending == 0) && (SciTxqCount(psPort, SCI_TXQ_CTRL) == 0));
+}
+
+//ʹѭеãһ֡ͽӲͳƣ
+//ٰȼһ֡uDMA
+void SciTxqProcess(tSciPort *psPort)
+{
+    tSciTxq *psTxq;
+    tSciTxFrame *psFrame;
+    tSciTxStats *psStats;
+    unsigned long ulLatency;
+    unsigned long ulSent;
+    tBoolean bMasked;
+    unsigned long i;
+
+    if(psPort->psTxqSending)
+    {
+        if(SciDmaTxBusy(psPort))
+        {
+            return;
+        }
+        psTxq = psPort->psTxqSending;
+        psFrame = &psTxq->psFrame[psTxq->ulHead & SCI_TXQ_MASK];
+        psStats = &psPort->psTxStats[psTxq - psPort->psTxq];
+        ulLatency = g_ulTickMs - psFrame->ulTime;
+        psStats->ulFrames++;
+        psStats->ulBytes += psFrame->ulLength;
+        psStats->ulLatencySum += ulLatency;
+        if(ulLatency > psStats->ulLatencyMax)
+        {
+            psStats->ulLatencyMax = ulLatency;
+        }
+        psTxq->ulHead++;
+        psPort->psTxqSending = 0;
+    }
+
+    for(i = 0; i < SCI_TXQ_CLASSES; i++)
+    {
+        psTxq = &psPort->psTxq[i];
+        if(psTxq->ulHead != psTxq->ulTail)
+        {
+            psFrame = &psTxq->psFrame[psTxq->ulHead & SCI_TXQ_MASK];
+            //򿪷ʹuDMA֮䲻ܲһ֡ķͽжϣʹܱر
+            bMasked = IntMasterDisable();
+            SciStationTxStart(psPort);
+            ulSent = SciDmaSend(psPort, psFrame->pucFrame, psFrame->ulLength);
+            if(!bMasked)
+            {
+                IntMasterEnable();
+            }
+            if(ulSent)
+            {
+                psPort->psTxqSending = psTxq;
+            }
+            return;
+        }
+    }
+}
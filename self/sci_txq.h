@@ -0,0 +1,51 @@
+#ifndef __SCI_TXQ_H__
+#define __SCI_TXQ_H__
+
+//----------------------------------SCIͶ
+//֡Ӻѭ֡uDMAͣʹ󲻱صȴһ֡
+//ÿ˿ڸһкͻأsci_port.h
+//ȼࣨӦÿһ֡ı߽ࣨPSO֡ͣ
+//Ӧȴһ֡ڷ͵֡
+//ulHeadֻɷʹдulTailֻд߾Ϊɼ
+#define SCI_TXQ_SIZE 4      //ÿгȣΪ2
+#define SCI_TXQ_MASK (SCI_TXQ_SIZE-1)
+
+#define SCI_TXQ_CTRL 0      //ࣺӦʹñģĻ
+#define SCI_TXQ_BULK 1      //ࣺ͵ݣʹ÷ͷԼĻ
+#define SCI_TXQ_CLASSES 2
+
+typedef struct
+{
+    const unsigned char *pucFrame; //֡ʼַ
+    unsigned long ulLength;        //ֽ֡
+    unsigned long ulTime;          //ʱ̣ms
+} tSciTxFrame;
+
+typedef struct
+{
+    unsigned long ulHead;          //ͼ
+    unsigned long ulTail;          //Ӽ
+    tSciTxFrame psFrame[SCI_TXQ_SIZE];
+} tSciTxq;
+
+//ÿķͳƣͳȡ
+typedef struct
+{
+    unsigned long ulFrames;        //ѷ֡
+    unsigned long ulBytes;         //ѷֽ
+    unsigned long ulLatencyMax;    //ϵʱ䣬ms
+    unsigned long ulLatencySum;    //ϵۼʱ䣬ms
+} tSciTxStats;
+
+extern void SciTxqInit(tSciPort *psPort);
+extern unsigned long SciTxqCount(tSciPort *psPort, unsigned long ulClass);
+extern unsigned char *SciTxqAlloc(tSciPort *psPort);
+extern unsigned long SciTxqPush(tSciPort *psPort, unsigned long ulClass,
+                                const unsigned char *pucFrame,
+                                unsigned long ulLength, unsigned long *pulTicket);
+extern unsigned long SciTxqDone(tSciPort *psPort, unsigned long ulClass,
+                                unsigned long ulTicket);
+extern unsigned long SciTxqIdle(tSciPort *psPort);
+extern void SciTxqProcess(tSciPort *psPort);
+
+#endif
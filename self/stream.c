@@ -0,0 +1,147 @@
+/*
+ *     stream.c
+ *
+ *     ң⣺λĶĶʱͲƹPSOsendĹ̶֡
+ *
+ *
+ */
+
+#include "global_var.h"
+#include "sci_port.h"
+#include "codec.h"
+#include "ipc_snap.h"
+
+///ȡ
+void SciCmdStream(void)
+{
+    tSciStreamState *psState = &g_psSciPort->sStream;
+    unsigned int uiId = RC_DataBUF[2];
+    unsigned long ulPeriod = CodecGetU16(&RC_DataBUF[3]);
+    unsigned int uiCount = RC_DataBUF[5];
+    tSciStream *psFree = 0;
+    tSciStream *psStream = 0;
+    unsigned int i;
+
+    if(PackLength != (7 + uiCount))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    for(i = 0; i < SCI_STREAM_MAX; i++)
+    {
+        if(psState->psStream[i].ulPeriod == 0)
+        {
+            if(psFree == 0)
+            {
+                psFree = &psState->psStream[i];
+            }
+        }
+        else if(psState->psStream[i].uiId == uiId)
+        {
+            psStream = &psState->psStream[i];
+        }
+    }
+
+    if(ulPeriod == 0)//ȡ
+    {
+        if(psStream)
+        {
+            psStream->ulPeriod = 0;
+        }
+        SciTxAck(ConfirmCode);
+        return;
+    }
+
+    if(psStream == 0)
+    {
+        psStream = psFree;
+    }
+    if((psStream == 0) || (uiCount == 0) || (uiCount > SCI_STREAM_PARAM_MAX))
+    {
+        SciTxAck(RejectCode);
+        return;
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        if(RC_DataBUF[6 + i] >= ParameterNumber)
+        {
+            SciTxAck(RejectCode);
+            return;
+        }
+        psStream->pucIndex[i] = RC_DataBUF[6 + i];
+    }
+    psStream->uiId = uiId;
+    psStream->uiCount = uiCount;
+    psStream->uiSample = 0;
+    psStream->ulNext = g_ulTickMs;
+    psStream->ulPeriod = ulPeriod;
+    SciTxAck(ConfirmCode);
+}
+
+//һ֡
+static void SciStreamBuild(tSciPort *psPort, tSciStream *psStream)
+{
+    tSciStreamState *psState = &psPort->sStream;
+    unsigned char *pucData = &psState->pucBuf[SCI_LONG_HEAD];
+    unsigned int i;
+
+    *pucData++ = psStream->uiId;//к
+    *pucData++ = Stream_Code;//
+    CodecPutU16(pucData, psStream->uiSample++);
+    pucData += 2;
+    CodecPutU16(pucData, g_usIpcSnapSeq);
+    pucData += 2;
+    for(i = 0; i < psStream->uiCount; i++)
+    {
+        CodecPutFloat(pucData, Paramet[psStream->pucIndex[i]]);
+        pucData += 4;
+    }
+    psState->ulLength = SciFrameLong(psPort, psState->pucBuf, pucData);
+}
+
+//ѭеãͻʱɵڵ
+//뷢ͶУӦȷ
+void SciStreamProcess(tSciPort *psPort)
+{
+    tSciStreamState *psState = &psPort->sStream;
+    unsigned int i;
+    tSciStream *psStream;
+
+    if(psState->ulQueued)
+    {
+        if(!SciTxqDone(psPort, SCI_TXQ_BULK, psState->ulTicket))
+        {
+            return;
+        }
+        psState->ulQueued = 0;
+        psState->ulLength = 0;
+    }
+
+    if(psState->ulLength == 0)
+    {
+        for(i = 1; i <= SCI_STREAM_MAX; i++)
+        {
+            psStream = &psState->psStream[(psState->uiLast + i) % SCI_STREAM_MAX];
+            if(psStream->ulPeriod &&
+               ((long)(g_ulTickMs - psStream->ulNext) >= 0))
+            {
+                psStream->ulNext += psStream->ulPeriod;
+                //󳬹һʱӵǰʱ¼ʱ
+                if((long)(g_ulTickMs - psStream->ulNext) >= 0)
+                {
+                    psStream->ulNext = g_ulTickMs + psStream->ulPeriod;
+                }
+                SciStreamBuild(psPort, psStream);
+                psState->uiLast = psStream - psState->psStream;
+                break;
+            }
+        }
+    }
+
+    if(psState->ulLength &&
+       SciTxqPush(psPort, SCI_TXQ_BULK, psState->pucBuf, psState->ulLength,
+                  &psState->ulTicket))
+    {
+        psState->ulQueued = 1;
+    }
+}
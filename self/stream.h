@@ -0,0 +1,37 @@
+#ifndef __STREAM_H__
+#define __STREAM_H__
+
+//----------------------------------ң
+//λǼһParametšںźM3ͣѯ
+//ݣ / ms(16λ) /  / ...Ϊ0ʾȡ
+//֡Ϊչ֡к= / =Stream_Code / (16λ) / ռ(16λ) / ֵ...
+//ռΪвȡԵC28յķλݴ˷ظC28
+#define SCI_STREAM_MAX 4          //ͬʱڵ
+#define SCI_STREAM_PARAM_MAX 32   //ÿĲ
+#define SCI_STREAM_BUF_SIZE (SCI_LONG_HEAD + 6 + 4 * SCI_STREAM_PARAM_MAX + 4) //У4ֽ
+
+typedef struct
+{
+    unsigned long ulPeriod;       //ڣms0ʾδʹ
+    unsigned long ulNext;         //´ηʱ̣ms
+    unsigned int uiId;            //ţΪ֡к
+    unsigned int uiCount;         //
+    unsigned int uiSample;        //
+    unsigned char pucIndex[SCI_STREAM_PARAM_MAX]; //
+} tSciStream;
+
+//˿ڵ״̬֡ĵĶ˿
+typedef struct
+{
+    tSciStream psStream[SCI_STREAM_MAX];
+    unsigned char pucBuf[SCI_STREAM_BUF_SIZE]; //֡ͻ
+    unsigned long ulLength;       //͵֡ȣ0ʾ
+    unsigned long ulQueued;       //֡ѷ뷢Ͷ
+    unsigned long ulTicket;       //֡ڷͶе
+    unsigned int uiLast;          //ϴη͵Ƶռ
+} tSciStreamState;
+
+extern void SciCmdStream(void);
+extern void SciStreamProcess(tSciPort *psPort);
+
+#endif
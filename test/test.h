@@ -0,0 +1,43 @@
+#ifndef __TEST_H__
+#define __TEST_H__
+
+//----------------------------------
+//self/Ӳ޹صģֱx86 Linuxϱ룬driverlibӿtest_stub.cģ
+//ÿԳܼ飬-bʱܲԣмʧʱ1
+//ϵݣֻ¾ʵֵԱȽϣM3ϵĺʱ
+#include <stdio.h>
+
+extern unsigned long g_ulTestFail;
+
+#define TEST_CHECK(x)                                                   \
+    do                                                                  \
+    {                                                                   \
+        if(!(x))                                                        \
+        {                                                               \
+            printf("%s:%d: %s\n", __FILE__, __LINE__, #x);              \
+            g_ulTestFail++;                                             \
+        }                                                               \
+    } while(0)
+
+extern int TestBench(int argc, char **argv);
+extern int TestResult(const char *pcName);
+extern double TestNow(void);
+extern unsigned long long TestCycles(void);
+//ϢRAMIPCĴӳΪڴ棬ʧʱ0
+extern int TestMsgRamMap(void);
+//дMTOCIPCSETλMTOCIPCFLG
+extern void TestIpcSet(void);
+//IPCLiteMtoCDataWrite()дĵַ
+extern unsigned long g_ulTestLiteAddress;
+extern unsigned long g_ulTestLiteData;
+
+//UARTFIFOUARTCharsAvail()/UARTCharGetNonBlocking()ȡֽ
+extern void TestUartFeed(const unsigned char *pucData, unsigned long ulCount);
+extern unsigned long TestUartCount(void);
+//uDMAͨƹҷʽֽдװصĻдֽ鶼дʱֹֽͨͣڲд
+extern unsigned long TestDmaRx(unsigned long ulChannel, const unsigned char *pucData,
+                               unsigned long ulCount);
+//UARTConfigSetExpClk()ΪUARTõĲ
+extern unsigned long TestUartBaud(unsigned long ulBase);
+
+#endif
@@ -0,0 +1,239 @@
+/*
+ *     test_baud.c
+ *
+ *     Э̣λһΪαն˵ĴӶˣʵһtermiosòʣ
+ *     ˽ӵ˿ڵUARTϣʲһʱÿֽڶմ
+ *     ԭӦл²յЧݰ󱣳֡ûилʱʱָ
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include "test.h"
+#include "test_port.h"
+#include "codec.h"
+
+#define TEST_BAUD_LINE 0x5A //ʲһʱֽմķʽ
+
+static int g_iMaster = -1;
+static int g_iSlave = -1;
+static tSciPort *g_psPort;
+
+static unsigned long TestSpeedBaud(speed_t sSpeed)
+{
+    switch(sSpeed)
+    {
+        case B9600:   return(9600);
+        case B19200:  return(19200);
+        case B57600:  return(57600);
+        case B115200: return(115200);
+        default:      return(0);
+    }
+}
+
+static speed_t TestBaudSpeed(unsigned long ulBaud)
+{
+    switch(ulBaud)
+    {
+        case 19200:  return(B19200);
+        case 57600:  return(B57600);
+        case 115200: return(B115200);
+        default:     return(B9600);
+    }
+}
+
+//λл
+static void TestHostBaud(unsigned long ulBaud)
+{
+    struct termios sTerm;
+
+    tcgetattr(g_iSlave, &sTerm);
+    cfsetispeed(&sTerm, TestBaudSpeed(ulBaud));
+    cfsetospeed(&sTerm, TestBaudSpeed(ulBaud));
+    tcsetattr(g_iSlave, TCSANOW, &sTerm);
+}
+
+//·λĲ˿UARTĲһʱֽԭ
+static void TestLine(unsigned char *pucData, unsigned long ulCount)
+{
+    struct termios sTerm;
+    unsigned long i;
+
+    tcgetattr(g_iSlave, &sTerm);
+    if(TestSpeedBaud(cfgetospeed(&sTerm)) !=
+       TestUartBaud(g_psPort->psConfig->ulBase))
+    {
+        for(i = 0; i < ulCount; i++)
+        {
+            pucData[i] ^= TEST_BAUD_LINE;
+        }
+    }
+}
+
+static void TestTx(tSciPort *psPort, const unsigned char *pucBuf,
+                   unsigned long ulCount)
+{
+    unsigned char pucLine[SCI_DMA_TX_MAX];
+
+    if(psPort != g_psPort)
+    {
+        return;
+    }
+    memcpy(pucLine, pucBuf, ulCount);
+    TestLine(pucLine, ulCount);
+    TEST_CHECK(write(g_iMaster, pucLine, ulCount) == (long)ulCount);
+}
+
+//M3һࣺȡαնյֽڣѭ
+static void TestPump(void)
+{
+    unsigned char pucLine[256];
+    long lCount;
+    int i;
+
+    for(i = 0; i < 4; i++)
+    {
+        lCount = read(g_iMaster, pucLine, sizeof(pucLine));
+        if(lCount > 0)
+        {
+            TestLine(pucLine, lCount);
+            TestPortRx(g_psPort, pucLine, lCount);
+        }
+        TestPortRun();
+    }
+}
+
+//λһ֡յӦȣУ飩ûЧӦʱ0
+static unsigned long TestRequest(unsigned char ucSerial, unsigned char ucCode,
+                                 const unsigned char *pucData, unsigned long ulCount,
+                                 unsigned char *pucBody)
+{
+    unsigned char pucFrame[64];
+    unsigned char pucReply[256];
+    const unsigned char *pucFound;
+    struct pollfd sPoll;
+    unsigned long ulReply = 0;
+    unsigned long ulLength;
+    long lCount;
+
+    ulLength = TestFrame(pucFrame, ucSerial, ucCode, pucData, ulCount);
+    TEST_CHECK(write(g_iSlave, pucFrame, ulLength) == (long)ulLength);
+    TestPump();
+
+    sPoll.fd = g_iSlave;
+    sPoll.events = POLLIN;
+    while((poll(&sPoll, 1, 50) > 0) && (ulReply < sizeof(pucReply)))
+    {
+        lCount = read(g_iSlave, &pucReply[ulReply], sizeof(pucReply) - ulReply);
+        if(lCount <= 0)
+        {
+            break;
+        }
+        ulReply += lCount;
+    }
+    ulLength = TestFrameFind(pucReply, ulReply, &pucFound);
+    if(ulLength)
+    {
+        memcpy(pucBody, pucFound, ulLength);
+    }
+    return(ulLength);
+}
+
+static unsigned long TestBaudRequest(unsigned long ulBaud, unsigned char *pucBody)
+{
+    unsigned char pucData[4];
+
+    CodecPutU32(pucData, ulBaud);
+    return(TestRequest(0x20, Baud_Code, pucData, 4, pucBody));
+}
+
+//0ӦΪȷ֡ʱ1
+static int TestRead(void)
+{
+    unsigned char pucBody[64];
+
+    return((TestRequest(0, 0x10, 0, 0, pucBody) == 8) && (pucBody[0] == 0) &&
+           (pucBody[2] == ConfirmCode));
+}
+
+static int TestOpen(void)
+{
+    struct termios sTerm;
+
+    g_iMaster = posix_openpt(O_RDWR | O_NOCTTY);
+    if((g_iMaster < 0) || grantpt(g_iMaster) || unlockpt(g_iMaster))
+    {
+        return(0);
+    }
+    g_iSlave = open(ptsname(g_iMaster), O_RDWR | O_NOCTTY);
+    if(g_iSlave < 0)
+    {
+        return(0);
+    }
+    fcntl(g_iMaster, F_SETFL, O_NONBLOCK);
+    tcgetattr(g_iSlave, &sTerm);
+    cfmakeraw(&sTerm);
+    tcsetattr(g_iSlave, TCSANOW, &sTerm);
+    TestHostBaud(SCI_BAUD_DEFAULT);
+    return(1);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned char pucBody[64];
+    unsigned long ulBase;
+
+    if(!TestOpen())
+    {
+        printf("test_baud: no pty, skipped\n");
+        return(0);
+    }
+    TestPortInit();
+    g_psPort = g_ppsSciPort[SCI_PORT_UART1];
+    ulBase = g_psPort->psConfig->ulBase;
+    g_pfnTestTx = TestTx;
+    TEST_CHECK(TestUartBaud(ulBase) == SCI_BAUD_DEFAULT);
+    TEST_CHECK(TestRead());
+
+    //UARTʱΧĲʱϣл
+    TEST_CHECK(TestBaudRequest(10000000, pucBody) == 4);
+    TEST_CHECK((pucBody[1] == Baud_Code) && (pucBody[2] == RejectCode));
+    TEST_CHECK(TestUartBaud(ulBase) == SCI_BAUD_DEFAULT);
+
+    //ԭӦӦлл²µЧݰʹ֮
+    TEST_CHECK(TestBaudRequest(115200, pucBody) == 4);
+    TEST_CHECK((pucBody[1] == Baud_Code) && (pucBody[2] == ConfirmCode));
+    TEST_CHECK(TestUartBaud(ulBase) == 115200);
+    TEST_CHECK(g_psPort->ulBaudState == SCI_BAUD_TRIAL);
+    TestHostBaud(115200);
+    TEST_CHECK(TestRead());
+    TEST_CHECK(g_psPort->ulBaudState == SCI_BAUD_IDLE);
+    g_ulTickMs += SCI_BAUD_TIMEOUT + 1;
+    TestPump();
+    TEST_CHECK(TestUartBaud(ulBase) == 115200);
+    TEST_CHECK(TestRead());
+
+    //ûյӦ𣨻ָ֧òʣԭʣʱǰմʱָ
+    TEST_CHECK(TestBaudRequest(57600, pucBody) == 4);
+    TEST_CHECK(pucBody[2] == ConfirmCode);
+    TEST_CHECK(TestUartBaud(ulBase) == 57600);
+    TEST_CHECK(!TestRead());
+    g_ulTickMs += SCI_BAUD_TIMEOUT - 1;
+    TestPump();
+    TEST_CHECK(TestUartBaud(ulBase) == 57600);
+    TEST_CHECK(!TestRead());
+    g_ulTickMs += 1;
+    TestPump();
+    TEST_CHECK(TestUartBaud(ulBase) == 115200);
+    TEST_CHECK(g_psPort->ulBaudState == SCI_BAUD_IDLE);
+    TEST_CHECK(TestRead());
+
+    close(g_iSlave);
+    close(g_iMaster);
+    return(TestResult("test_baud"));
+}
@@ -0,0 +1,229 @@
+/*
+ *     test_codec.c
+ *
+ *     codec.hֶλϵС/ֽ˳floatֵ
+ *     ܲԭFLOAT_COMFλֽڿȽ
+ *
+ *
+ */
+
+#include <math.h>
+#include "test.h"
+#include "codec.h"
+
+//ԭȫ壬ÿֽһλȡ
+struct TEST_COMF_BITS
+{
+    unsigned int MEM1:8;
+    unsigned int MEM2:8;
+    unsigned int MEM3:8;
+    unsigned int MEM4:8;
+};
+
+union TEST_COMF
+{
+    float all;
+    struct TEST_COMF_BITS bit;
+};
+
+union TEST_COMF FData_send;
+union TEST_COMF FData_get;
+
+#define TEST_CODEC_PARAMS 118   //ParameterNumberͬһȫ
+#define TEST_CODEC_LOOPS 200000
+
+static void TestRoundTrip(void)
+{
+    static const uint32_t pulValue[] =
+    {
+        0, 1, 0x80, 0xFF, 0x100, 0x7FFF, 0x8000, 0xFFFF, 0x12345678,
+        0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0xA5C3F00F
+    };
+    static const float pfValue[] =
+    {
+        0.0f, -0.0f, 1.0f, -1.0f, 3.14159265f, 1e-40f, 3.4028235e38f,
+        -1.17549435e-38f, INFINITY, -INFINITY
+    };
+    uint8_t pucBuf[16];
+    uint32_t ulBits;
+    float fValue;
+    unsigned long i;
+    unsigned long ulOff;
+
+    //ֶ֡οԴֽڿʼ
+    for(ulOff = 0; ulOff < 8; ulOff++)
+    {
+        for(i = 0; i < sizeof(pulValue) / sizeof(pulValue[0]); i++)
+        {
+            memset(pucBuf, 0xCC, sizeof(pucBuf));
+            CodecPutU32(&pucBuf[ulOff], pulValue[i]);
+            TEST_CHECK(CodecGetU32(&pucBuf[ulOff]) == pulValue[i]);
+            TEST_CHECK((ulOff == 0) || (pucBuf[ulOff - 1] == 0xCC));
+            TEST_CHECK(pucBuf[ulOff + 4] == 0xCC);
+
+            CodecPutU16(&pucBuf[ulOff], (uint16_t)pulValue[i]);
+            TEST_CHECK(CodecGetU16(&pucBuf[ulOff]) == (uint16_t)pulValue[i]);
+            CodecPutU16Be(&pucBuf[ulOff], (uint16_t)pulValue[i]);
+            TEST_CHECK(CodecGetU16Be(&pucBuf[ulOff]) == (uint16_t)pulValue[i]);
+        }
+        for(i = 0; i < sizeof(pfValue) / sizeof(pfValue[0]); i++)
+        {
+            CodecPutFloat(&pucBuf[ulOff], pfValue[i]);
+            fValue = CodecGetFloat(&pucBuf[ulOff]);
+            TEST_CHECK(memcmp(&fValue, &pfValue[i], sizeof(fValue)) == 0);
+        }
+
+        //NaNλԭ
+        ulBits = 0x7FC12345;
+        memcpy(&fValue, &ulBits, sizeof(fValue));
+        CodecPutFloat(&pucBuf[ulOff], fValue);
+        TEST_CHECK(CodecGetU32(&pucBuf[ulOff]) == 0x7FC12345);
+        fValue = CodecGetFloat(&pucBuf[ulOff]);
+        TEST_CHECK(isnan(fValue));
+    }
+}
+
+//ֽ˳̶ֽ޹
+static void TestByteOrder(void)
+{
+    static const uint8_t pucU32[4] = { 0x78, 0x56, 0x34, 0x12 };
+    static const uint8_t pucOne[4] = { 0x00, 0x00, 0x80, 0x3F };
+    static const uint8_t pucMinus[4] = { 0x00, 0x00, 0x20, 0xC1 };
+    uint8_t pucBuf[4];
+
+    CodecPutU32(pucBuf, 0x12345678);
+    TEST_CHECK(memcmp(pucBuf, pucU32, 4) == 0);
+    TEST_CHECK(CodecGetU32(pucU32) == 0x12345678);
+
+    CodecPutU16(pucBuf, 0xABCD);
+    TEST_CHECK((pucBuf[0] == 0xCD) && (pucBuf[1] == 0xAB));
+    CodecPutU16Be(pucBuf, 0xABCD);
+    TEST_CHECK((pucBuf[0] == 0xAB) && (pucBuf[1] == 0xCD));
+
+    CodecPutFloat(pucBuf, 1.0f);
+    TEST_CHECK(memcmp(pucBuf, pucOne, 4) == 0);
+    CodecPutFloat(pucBuf, -10.0f);
+    TEST_CHECK(memcmp(pucBuf, pucMinus, 4) == 0);
+    TEST_CHECK(CodecGetFloat(pucMinus) == -10.0f);
+}
+
+//ԭ巽С˻ϣM3x86Сˣֽͬ
+static void TestUnionCompat(void)
+{
+    uint8_t pucBuf[4];
+    float fValue;
+    unsigned long i;
+
+    for(i = 0; i < 1000; i++)
+    {
+        fValue = (float)i * 0.37f - 150.0f;
+        FData_send.all = fValue;
+        CodecPutFloat(pucBuf, fValue);
+        TEST_CHECK((pucBuf[0] == FData_send.bit.MEM1) &&
+                   (pucBuf[1] == FData_send.bit.MEM2) &&
+                   (pucBuf[2] == FData_send.bit.MEM3) &&
+                   (pucBuf[3] == FData_send.bit.MEM4));
+    }
+}
+
+//Ӧȫд֡棬ٶأÿַȡһ֣ns/
+static void TestCodecBench(void)
+{
+    static float pfParam[TEST_CODEC_PARAMS];
+    static float pfBack[TEST_CODEC_PARAMS];
+    static uint8_t pucFrame[3 + 4 * TEST_CODEC_PARAMS];
+    double dUnionPut = 1e9, dUnionGet = 1e9, dCodecPut = 1e9, dCodecGet = 1e9;
+    double dStart;
+    double dTime;
+    unsigned long ulLoop;
+    unsigned long ulRound;
+    unsigned long i;
+    uint8_t *pucData;
+
+    for(i = 0; i < TEST_CODEC_PARAMS; i++)
+    {
+        pfParam[i] = (float)i * 1.5f;
+    }
+
+    for(ulRound = 0; ulRound < 5; ulRound++)
+    {
+        dStart = TestNow();
+        for(ulLoop = 0; ulLoop < TEST_CODEC_LOOPS; ulLoop++)
+        {
+            pucData = &pucFrame[3];//кš롢ȷ֮󣬲
+            for(i = 0; i < TEST_CODEC_PARAMS; i++)
+            {
+                FData_send.all = pfParam[i];
+                *pucData++ = FData_send.bit.MEM1;
+                *pucData++ = FData_send.bit.MEM2;
+                *pucData++ = FData_send.bit.MEM3;
+                *pucData++ = FData_send.bit.MEM4;
+            }
+            __asm__ volatile("" : : "r"(pucFrame) : "memory");
+        }
+        dTime = TestNow() - dStart;
+        dUnionPut = (dTime < dUnionPut) ? dTime : dUnionPut;
+
+        dStart = TestNow();
+        for(ulLoop = 0; ulLoop < TEST_CODEC_LOOPS; ulLoop++)
+        {
+            pucData = &pucFrame[3];
+            for(i = 0; i < TEST_CODEC_PARAMS; i++)
+            {
+                FData_get.bit.MEM1 = *pucData++;
+                FData_get.bit.MEM2 = *pucData++;
+                FData_get.bit.MEM3 = *pucData++;
+                FData_get.bit.MEM4 = *pucData++;
+                pfBack[i] = FData_get.all;
+            }
+            __asm__ volatile("" : : "r"(pfBack) : "memory");
+        }
+        dTime = TestNow() - dStart;
+        dUnionGet = (dTime < dUnionGet) ? dTime : dUnionGet;
+        TEST_CHECK(memcmp(pfBack, pfParam, sizeof(pfParam)) == 0);
+
+        dStart = TestNow();
+        for(ulLoop = 0; ulLoop < TEST_CODEC_LOOPS; ulLoop++)
+        {
+            for(i = 0; i < TEST_CODEC_PARAMS; i++)
+            {
+                CodecPutFloat(&pucFrame[3 + 4 * i], pfParam[i]);
+            }
+            __asm__ volatile("" : : "r"(pucFrame) : "memory");
+        }
+        dTime = TestNow() - dStart;
+        dCodecPut = (dTime < dCodecPut) ? dTime : dCodecPut;
+
+        memset(pfBack, 0, sizeof(pfBack));
+        dStart = TestNow();
+        for(ulLoop = 0; ulLoop < TEST_CODEC_LOOPS; ulLoop++)
+        {
+            for(i = 0; i < TEST_CODEC_PARAMS; i++)
+            {
+                pfBack[i] = CodecGetFloat(&pucFrame[3 + 4 * i]);
+            }
+            __asm__ volatile("" : : "r"(pfBack) : "memory");
+        }
+        dTime = TestNow() - dStart;
+        dCodecGet = (dTime < dCodecGet) ? dTime : dCodecGet;
+        TEST_CHECK(memcmp(pfBack, pfParam, sizeof(pfParam)) == 0);
+    }
+
+    dTime = 1e9 / ((double)TEST_CODEC_LOOPS * TEST_CODEC_PARAMS);
+    printf("codec put float: union %.2f ns, codec %.2f ns\n",
+           dUnionPut * dTime, dCodecPut * dTime);
+    printf("codec get float: union %.2f ns, codec %.2f ns\n",
+           dUnionGet * dTime, dCodecGet * dTime);
+}
+
+int main(int argc, char **argv)
+{
+    TestRoundTrip();
+    TestByteOrder();
+    TestUnionCompat();
+    if(TestBench(argc, argv))
+    {
+        TestCodecBench();
+    }
+    return(TestResult("test_codec"));
+}
@@ -0,0 +1,261 @@
+/*
+ *     test_crc.c
+ *
+ *     ֡У飺CRC16/CRC32/ModbusԼֵֽɿһ£PSO֡ںУ±ԭе0xFF֡β
+ *     ЭCRC󰴶˿ڵУ鷽ʽ֡βȺͬĹ֤
+ *     ܲԱȽϺУ顢CRC16CRC32ÿֽڵʱ
+ *
+ *
+ */
+
+#include <stdlib.h>
+#include "test.h"
+#include "test_port.h"
+#include "crc.h"
+#include "codec.h"
+
+#define TEST_CRC_LOOPS 2000
+
+static unsigned char g_pucTestTx[SCI_DMA_TX_MAX];
+static unsigned long g_ulTestTxCount;
+
+static void TestTx(tSciPort *psPort, const unsigned char *pucBuf,
+                   unsigned long ulCount)
+{
+    if(psPort == g_ppsSciPort[SCI_PORT_UART1])
+    {
+        memcpy(g_pucTestTx, pucBuf, ulCount);
+        g_ulTestTxCount = ulCount;
+    }
+}
+
+static void TestCrcCheck(void)
+{
+    static const unsigned char pucCheck[9] =
+    {
+        '1', '2', '3', '4', '5', '6', '7', '8', '9'
+    };
+    unsigned char pucData[300];
+    unsigned long ulCrc;
+    unsigned long i;
+
+    TEST_CHECK(CrcSoft(CRC_MODE_16, pucCheck, 9) == 0x31C3);
+    TEST_CHECK(CrcSoft(CRC_MODE_32, pucCheck, 9) == 0x89A1897F);
+    TEST_CHECK(CrcModbus(pucCheck, 9) == 0x4B37);
+    //uCRCãԼʧܺɿʹ
+    TEST_CHECK(g_ulCrcHw == 0);
+
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        pucData[i] = rand();
+    }
+    ulCrc = 0;
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        ulCrc = CrcUpdate(CRC_MODE_32, ulCrc, pucData[i]);
+    }
+    TEST_CHECK(ulCrc == CrcBlock(CRC_MODE_32, pucData, sizeof(pucData)));
+    ulCrc = 0;
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        ulCrc = CrcUpdate(CRC_MODE_16, ulCrc, pucData[i]);
+    }
+    TEST_CHECK(ulCrc == CrcBlock(CRC_MODE_16, pucData, sizeof(pucData)));
+}
+
+//һ֡PSOݣ֡ӡ͡ȷϷ
+static void TestPsoSend(float *pfU)
+{
+    g_ulTestTxCount = 0;
+    PSOSENDF = 1;
+    PSOsend(pfU);
+    PSOsend(pfU);
+    TestPortRun();
+    TestPortRun();
+    PSOsend(pfU);
+    TEST_CHECK(PSOSENDF == 0);
+}
+
+static void TestPso(void)
+{
+    tSciPort *psPort = g_ppsSciPort[SCI_PORT_UART1];
+    const unsigned char *pucBody;
+    float pfU[10];
+    unsigned long i;
+
+    for(i = 0; i < 10; i++)
+    {
+        pfU[i] = (float)i * 0.25f;
+    }
+    g_pfnTestTx = TestTx;
+
+    //У飺ԭе48ֽ֡43֡βΪ0xFFУ
+    TestPsoSend(pfU);
+    TEST_CHECK(g_ulTestTxCount == PSONumber);
+    TEST_CHECK((g_pucTestTx[0] == PackHead) && (g_pucTestTx[3] == PackHead));
+    TEST_CHECK(g_pucTestTx[4] == 43);
+    TEST_CHECK(g_pucTestTx[PSONumber - 1] == 0xFF);
+    pucBody = &g_pucTestTx[5];
+    TEST_CHECK((pucBody[0] == 200) && (pucBody[1] == 0xFF));
+    TEST_CHECK(CodecGetFloat(&pucBody[2 + 4 * 9]) == pfU[9]);
+
+    //ЭΪCRC16/CRC32֡βӦ֡ͬ
+    psPort->ulCrcMode = CRC_MODE_16;
+    psPort->uiTrailer = CrcLength(CRC_MODE_16);
+    TestPsoSend(pfU);
+    TEST_CHECK(g_ulTestTxCount == PSONumber + 1);
+    TEST_CHECK(g_pucTestTx[4] == 44);
+    TEST_CHECK(CodecGetU16(&g_pucTestTx[47]) == CrcSoft(CRC_MODE_16, &g_pucTestTx[4], 43));
+
+    psPort->ulCrcMode = CRC_MODE_32;
+    psPort->uiTrailer = CrcLength(CRC_MODE_32);
+    TestPsoSend(pfU);
+    TEST_CHECK(g_ulTestTxCount == PSONumber + 3);
+    TEST_CHECK(g_pucTestTx[4] == 46);
+    TEST_CHECK(CodecGetU32(&g_pucTestTx[47]) == CrcSoft(CRC_MODE_32, &g_pucTestTx[4], 43));
+
+    psPort->ulCrcMode = CRC_MODE_SUM;
+    psPort->uiTrailer = CrcLength(CRC_MODE_SUM);
+
+    //Modbusվ
+    psPort->ulFraming = SCI_FRAMING_MODBUS;
+    g_ulTestTxCount = 0;
+    PSOSENDF = 1;
+    PSOsend(pfU);
+    PSOsend(pfU);
+    TestPortRun();
+    TEST_CHECK(g_ulTestTxCount == 0);
+    psPort->ulFraming = SCI_FRAMING_FE;
+    PSOSENDF = 0;
+}
+
+//յһ֡ȺPSO_g[0]ΪfValueulModeΪ֡βУ鷽ʽµ0xFFCRC16
+//ulBad0ʱ֡βĴ
+static void TestPsoFeedback(unsigned long ulMode, float fValue, unsigned long ulBad)
+{
+    tSciPort *psPort = g_ppsSciPort[SCI_PORT_UART1];
+    unsigned char pucFrame[32];
+    unsigned long ulCount;
+    unsigned long i;
+
+    pucFrame[0] = PackHead;
+    pucFrame[1] = PackHead;
+    pucFrame[2] = PackHead;
+    pucFrame[3] = PackHead;
+    pucFrame[5] = 200;
+    pucFrame[6] = 0x55;
+    for(i = 0; i < 4; i++)
+    {
+        CodecPutFloat(&pucFrame[7 + 4 * i], fValue);
+    }
+    if(ulMode == CRC_MODE_SUM)
+    {
+        pucFrame[4] = 19;
+        pucFrame[23] = ulBad ? 0xFE : 0xFF;
+        ulCount = 24;
+    }
+    else
+    {
+        pucFrame[4] = 20;
+        CodecPutU16(&pucFrame[23], CrcSoft(CRC_MODE_16, &pucFrame[4], 19) ^ ulBad);
+        ulCount = 25;
+    }
+    PSO_g[0] = 0;
+    TestPortRx(psPort, pucFrame, ulCount);
+    TestPortRun();
+}
+
+static void TestPsoGate(void)
+{
+    tSciPort *psPort = g_ppsSciPort[SCI_PORT_UART1];
+    unsigned long i;
+
+    //У飺ֻ0xFF֡β
+    TestPsoFeedback(CRC_MODE_SUM, 1.5f, 0);
+    TEST_CHECK(PSO_g[0] == 1.5f);
+    TestPsoFeedback(CRC_MODE_SUM, 1.5f, 1);
+    TEST_CHECK(PSO_g[0] == 0);
+
+    //CRC16CRC֤֡βһֽʲôӰ
+    psPort->ulCrcMode = CRC_MODE_16;
+    psPort->uiTrailer = CrcLength(CRC_MODE_16);
+    for(i = 0; i < 64; i++)
+    {
+        TestPsoFeedback(CRC_MODE_16, 2.5f + i, 0);
+        TEST_CHECK(PSO_g[0] == 2.5f + i);
+        TestPsoFeedback(CRC_MODE_16, 2.5f + i, 0x0100);
+        TEST_CHECK(PSO_g[0] == 0);
+    }
+    psPort->ulCrcMode = CRC_MODE_SUM;
+    psPort->uiTrailer = CrcLength(CRC_MODE_SUM);
+}
+
+//SciTxCheck()ͬĺУ
+static unsigned long TestSum(const unsigned char *pucData, unsigned long ulCount)
+{
+    unsigned int uiSum = 0;
+
+    while(ulCount--)
+    {
+        uiSum += *pucData++;
+    }
+    return((~uiSum + 1) & 0xFF);
+}
+
+//ÿֽڵʱڣȡ5һ֣ȵӰ
+static double TestCrcCycles(unsigned long ulMode, const unsigned char *pucData,
+                            unsigned long ulSize)
+{
+    unsigned long long ullStart;
+    unsigned long long ullBest = ~0ULL;
+    volatile unsigned long ulSink = 0;
+    unsigned long ulRound;
+    unsigned long ulLoop;
+
+    for(ulRound = 0; ulRound < 5; ulRound++)
+    {
+        ullStart = TestCycles();
+        for(ulLoop = 0; ulLoop < TEST_CRC_LOOPS; ulLoop++)
+        {
+            ulSink += (ulMode == CRC_MODE_SUM) ? TestSum(pucData, ulSize) :
+                      CrcBlock(ulMode, pucData, ulSize);
+            __asm__ volatile("" : : : "memory");
+        }
+        ullStart = TestCycles() - ullStart;
+        ullBest = (ullStart < ullBest) ? ullStart : ullBest;
+    }
+    return((double)ullBest / (TEST_CRC_LOOPS * ulSize));
+}
+
+static void TestCrcBench(void)
+{
+    static const unsigned long pulSize[] = { 8, 64, 512 };
+    unsigned char pucData[512];
+    unsigned long i;
+
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        pucData[i] = rand();
+    }
+    printf("crc cycles/byte (host, uCRC unavailable):  sum    crc16  crc32\n");
+    for(i = 0; i < sizeof(pulSize) / sizeof(pulSize[0]); i++)
+    {
+        printf("  %3lu-byte frame                          %5.2f  %5.2f  %5.2f\n",
+               pulSize[i], TestCrcCycles(CRC_MODE_SUM, pucData, pulSize[i]),
+               TestCrcCycles(CRC_MODE_16, pucData, pulSize[i]),
+               TestCrcCycles(CRC_MODE_32, pucData, pulSize[i]));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    TestPortInit();
+    TestCrcCheck();
+    TestPso();
+    TestPsoGate();
+    if(TestBench(argc, argv))
+    {
+        TestCrcBench();
+    }
+    return(TestResult("test_crc"));
+}
@@ -0,0 +1,173 @@
+/*
+ *     test_ipc_ring.c
+ *
+ *     M3C28Ϣλ߳ΪM3ӣһ߳ģC28ȡУ飬
+ *     ϢȲһ16λдٴΣܲԸÿϢ
+ *
+ *
+ */
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include "test.h"
+#include "global_var.h"
+#include "ipc_ring.h"
+#include "hw_types.h"
+
+#define TEST_IPC_MSGS 200000        //ܼϢ
+#define TEST_IPC_BENCH 4000000      //ܲԵϢ
+#define TEST_IPC_LEN_MAX 64         //Ϣ
+
+static tIpcRing *g_psRing;
+static unsigned long g_ulMsgs;
+static volatile unsigned long g_ulConsumed;
+static volatile unsigned long g_ulBad;
+
+//ulSeqϢĳȺݣߺ߰ͬĹ
+static unsigned long TestMsgLength(unsigned long ulSeq)
+{
+    return(2 + (ulSeq * 7) % (TEST_IPC_LEN_MAX - 1));
+}
+
+static unsigned short TestMsgWord(unsigned long ulSeq, unsigned long i)
+{
+    return(i ? (unsigned short)(ulSeq * 31 + i) : TestMsgLength(ulSeq));
+}
+
+//ģC28дʱȡһϢУӶ
+static void *TestC28(void *pvArg)
+{
+    volatile unsigned short *pusRead = (volatile unsigned short *)M3_CTOM_RINGREAD;
+    unsigned short usRead = 0;
+    unsigned long ulSeq = 0;
+    unsigned long ulLength;
+    unsigned long i;
+
+    while(ulSeq < g_ulMsgs)
+    {
+        if(g_psRing->usWrite == usRead)
+        {
+            sched_yield();
+            continue;
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        ulLength = g_psRing->pusBuf[usRead & IPC_RING_MASK];
+        for(i = 0; i < ulLength; i++)
+        {
+            if(g_psRing->pusBuf[(usRead + i) & IPC_RING_MASK] != TestMsgWord(ulSeq, i))
+            {
+                g_ulBad++;
+                break;
+            }
+        }
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        usRead += ulLength;
+        *pusRead = usRead;
+        ulSeq++;
+        g_ulConsumed = ulSeq;
+    }
+    return(0);
+}
+
+//M3ʱóCPU
+static unsigned long TestM3(void)
+{
+    unsigned short pusMsg[TEST_IPC_LEN_MAX + 1];
+    unsigned long ulWords = 0;
+    unsigned long ulSeq;
+    unsigned long ulLength;
+    unsigned long i;
+
+    for(ulSeq = 0; ulSeq < g_ulMsgs; ulSeq++)
+    {
+        ulLength = TestMsgLength(ulSeq);
+        for(i = 0; i < ulLength; i++)
+        {
+            pusMsg[i] = TestMsgWord(ulSeq, i);
+        }
+        while(!IpcRingPut(pusMsg, ulLength))
+        {
+            sched_yield();
+        }
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        ulWords += ulLength;
+    }
+    return(ulWords);
+}
+
+static double TestRun(unsigned long ulMsgs, unsigned long *pulWords)
+{
+    pthread_t sThread;
+    double dStart;
+
+    IpcRingInit();
+    HWREGH(M3_CTOM_RINGREAD) = 0;
+    g_ulMsgs = ulMsgs;
+    g_ulConsumed = 0;
+    g_ulBad = 0;
+    dStart = TestNow();
+    pthread_create(&sThread, 0, TestC28, 0);
+    *pulWords = TestM3();
+    pthread_join(sThread, 0);
+    return(TestNow() - dStart);
+}
+
+//̣߳0xFFFFʱϢ绺ĩβ
+static void TestWrap(void)
+{
+    unsigned short pusMsg[4] = { 4, 0x11, 0x22, 0x33 };
+
+    IpcRingInit();
+    IpcRingCommit(0xFFFE);
+    HWREGH(M3_CTOM_RINGREAD) = 0xFFFE;
+    TEST_CHECK(IpcRingFree() == IPC_RING_SIZE);
+    TEST_CHECK(IpcRingPut(pusMsg, 4));
+    TEST_CHECK(g_psRing->usWrite == 2);
+    TEST_CHECK(IpcRingFree() == IPC_RING_SIZE - 4);
+    TEST_CHECK(g_psRing->pusBuf[0xFFFE & IPC_RING_MASK] == 4);
+    TEST_CHECK(g_psRing->pusBuf[0xFFFF & IPC_RING_MASK] == 0x11);
+    TEST_CHECK(g_psRing->pusBuf[0] == 0x22);
+    TEST_CHECK(g_psRing->pusBuf[1] == 0x33);
+
+    //дʧܣԽ0ָ
+    IpcRingCommit(IPC_RING_SIZE - 4);
+    TEST_CHECK(IpcRingFree() == 0);
+    TEST_CHECK(!IpcRingPut(pusMsg, 1));
+    HWREGH(M3_CTOM_RINGREAD) = 2;
+    TEST_CHECK(IpcRingFree() == 4);
+    TEST_CHECK(IpcRingPut(pusMsg, 4));
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long *pulMsgRam = (void *)M3_MTOC_PASSMSG;
+    unsigned long ulWords;
+    double dTime;
+
+    if(!TestMsgRamMap())
+    {
+        printf("test_ipc_ring: message RAM not mappable, skipped\n");
+        return(0);
+    }
+    IpcRingInit();
+    g_psRing = (tIpcRing *)pulMsgRam[3];//C28MTOC_PASSMSG[3]ҵ
+
+    TestWrap();
+
+    TestRun(TEST_IPC_MSGS, &ulWords);
+    TEST_CHECK(g_ulConsumed == TEST_IPC_MSGS);
+    TEST_CHECK(g_ulBad == 0);
+    TEST_CHECK(ulWords / 65536 >= 64);//16λƴ
+
+    if(TestBench(argc, argv))
+    {
+        dTime = TestRun(TEST_IPC_BENCH, &ulWords);
+        TEST_CHECK((g_ulConsumed == TEST_IPC_BENCH) && (g_ulBad == 0));
+        printf("ipc ring: %lu msgs, %lu counter wraps, %.2f M msgs/s, %.1f M words/s, "
+               "%lu full retries (host)\n",
+               (unsigned long)TEST_IPC_BENCH, ulWords / 65536,
+               TEST_IPC_BENCH / dTime / 1e6, ulWords / dTime / 1e6, g_ulIpcRingFull);
+    }
+    return(TestResult("test_ipc_ring"));
+}
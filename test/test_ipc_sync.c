@@ -0,0 +1,272 @@
+/*
+ *     test_ipc_sync.c
+ *
+ *     ParametͬC28ĸдֻϢУѹ鰴¼װϢ
+ *     鲢飬һϢ龭ƹһIPC-Liteд룻
+ *     һC28ʱһճ鶼C28ʱȴ
+ *     C28ɱļģ⣺Ȱ˳Ŀ飬ٰȡλеϢ
+ *
+ *
+ */
+
+#include "test.h"
+#include "global_var.h"
+#include "ipc_ring.h"
+#include "ipc_block.h"
+#include "ipc_sync.h"
+#include "hw_types.h"
+#include "hw_memmap.h"
+#include "hw_ipc.h"
+
+#define TEST_MSG_MAX 16
+#define TEST_C28_PARAM 0x8000   //C28ַC2816λֱַ
+
+//C28յһϢԴͲ
+typedef struct
+{
+    char cSource;   //'R'λ 'B'ƹһ 'L' IPC-Lite
+    unsigned int uiCount;
+    unsigned char pucIndex[ParameterNumber];
+} tTestMsg;
+
+//S0S1ʼC28̶ַȡ
+extern tIpcBlock __start_SHARERAMS0[];
+extern tIpcBlock __start_SHARERAMS1[];
+
+static tIpcRing *g_psRing;
+static unsigned short g_usRead;
+static unsigned short g_usBlockSeq;
+static int g_iBlockHold;    //C28ݲĿ
+static tTestMsg g_psMsg[TEST_MSG_MAX];
+static unsigned long g_ulMsgs;
+
+static void TestC28Msg(char cSource, const volatile unsigned short *pusBase,
+                       unsigned long ulMask, unsigned long ulStart)
+{
+    tTestMsg *psMsg = &g_psMsg[g_ulMsgs++ % TEST_MSG_MAX];
+    unsigned int i;
+
+    TEST_CHECK(pusBase[(ulStart + 2) & ulMask] == BulkWriteMap_Code);
+    psMsg->cSource = cSource;
+    psMsg->uiCount = pusBase[(ulStart + 3) & ulMask];
+    TEST_CHECK(pusBase[ulStart & ulMask] == 4 + 5 * psMsg->uiCount);
+    for(i = 0; i < psMsg->uiCount; i++)
+    {
+        psMsg->pucIndex[i] = pusBase[(ulStart + 4 + 5 * i) & ulMask];
+    }
+}
+
+//ģC28ѭIPCжϣIPC-LiteĿ顢λеϢ
+static void TestC28(void)
+{
+    static const unsigned long pulFlag[2] = { IPC_BLOCK_FLAG0, IPC_BLOCK_FLAG1 };
+    volatile tIpcBlock *psBlock;
+    unsigned long ulStart;
+    unsigned long ulFlag;
+
+    TestIpcSet();
+    ulFlag = HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG);
+    if(ulFlag & IPC_LITE_FLAG)
+    {
+        g_psMsg[g_ulMsgs % TEST_MSG_MAX].cSource = 'L';
+        g_psMsg[g_ulMsgs % TEST_MSG_MAX].uiCount = 1;
+        g_psMsg[g_ulMsgs % TEST_MSG_MAX].pucIndex[0] =
+            (g_ulTestLiteAddress - TEST_C28_PARAM) / 2;
+        g_ulMsgs++;
+        HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) &= ~(IPC_LITE_FLAG | IPC_LITE_STATUS);
+    }
+    //鶼ѽʱȶusSeqСһ
+    while(!g_iBlockHold && (ulFlag & pulFlag[g_usBlockSeq & 1]))
+    {
+        psBlock = (g_usBlockSeq & 1) ? __start_SHARERAMS1 : __start_SHARERAMS0;
+        TEST_CHECK(psBlock->usSeq == (unsigned short)(g_usBlockSeq + 1));
+        for(ulStart = 0; ulStart < psBlock->usCount; ulStart += psBlock->pusData[ulStart])
+        {
+            TestC28Msg('B', psBlock->pusData, ~0UL, ulStart);
+        }
+        ulFlag &= ~pulFlag[g_usBlockSeq & 1];
+        HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) &= ~pulFlag[g_usBlockSeq & 1];
+        g_usBlockSeq++;
+    }
+    if(ulFlag & IPC_BLOCK_FLAGS)
+    {
+        return;
+    }
+    while(g_usRead != g_psRing->usWrite)
+    {
+        TestC28Msg('R', g_psRing->pusBuf, IPC_RING_MASK, g_usRead);
+        g_usRead += g_psRing->pusBuf[g_usRead & IPC_RING_MASK];
+        HWREGH(M3_CTOM_RINGREAD) = g_usRead;
+    }
+}
+
+//ϢеĲǡΪ[uiFirst, uiFirst+uiCount)
+static int TestMsgRange(const tTestMsg *psMsg, unsigned int uiFirst, unsigned int uiCount)
+{
+    unsigned int i;
+
+    if(psMsg->uiCount != uiCount)
+    {
+        return(0);
+    }
+    for(i = 0; i < uiCount; i++)
+    {
+        if(psMsg->pucIndex[i] != uiFirst + i)
+        {
+            return(0);
+        }
+    }
+    return(1);
+}
+
+//һд[uiFirst, uiFirst+uiCount)IpcSyncProcess()
+static void TestRequest(unsigned int uiFirst, unsigned int uiCount)
+{
+    unsigned int i;
+
+    for(i = uiFirst; i < uiFirst + uiCount; i++)
+    {
+        Paramet[i] = i;
+        IpcSyncMark(i);
+    }
+    IpcSyncProcess();
+}
+
+//C28ݲӦIPC-Liteڼѹ
+static void TestHold(int iHold)
+{
+    if(iHold)
+    {
+        HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) |= IPC_LITE_STATUS;
+    }
+    else
+    {
+        HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) &= ~IPC_LITE_STATUS;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    unsigned long *pulMsgRam = (void *)M3_MTOC_PASSMSG;
+    unsigned long ulBase;
+
+    if(!TestMsgRamMap())
+    {
+        printf("test_ipc_sync: message RAM not mappable, skipped\n");
+        return(0);
+    }
+    IpcRingInit();
+    IpcBlockInit();
+    g_psRing = (tIpcRing *)pulMsgRam[3];
+
+    //һδطȫòһϢ
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(g_ulMsgs == 2);
+    TEST_CHECK((g_psMsg[0].cSource == 'B') &&
+               TestMsgRange(&g_psMsg[0], RunParamNumber, IPC_SYNC_RECORD_MAX));
+    TEST_CHECK(TestMsgRange(&g_psMsg[1], RunParamNumber + IPC_SYNC_RECORD_MAX,
+                            ParameterNumber - RunParamNumber - IPC_SYNC_RECORD_MAX));
+
+    //һһϢ
+    ulBase = g_ulMsgs;
+    TestRequest(60, 3);
+    TestC28();
+    TEST_CHECK((g_ulMsgs == ulBase + 1) && (g_psMsg[ulBase % TEST_MSG_MAX].cSource == 'R'));
+    TEST_CHECK(TestMsgRange(&g_psMsg[ulBase % TEST_MSG_MAX], 60, 3));
+
+    //ѹ20ǰװһϢһ
+    TestHold(1);
+    TestRequest(44, 20);
+    TestRequest(64, 20);
+    TestRequest(84, 20);
+    TestHold(0);
+    ulBase = g_ulMsgs;
+    IpcSyncProcess();
+    TestC28();
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(g_ulMsgs == ulBase + 2);
+    TEST_CHECK(TestMsgRange(&g_psMsg[ulBase % TEST_MSG_MAX], 44, 40));
+    TEST_CHECK(TestMsgRange(&g_psMsg[(ulBase + 1) % TEST_MSG_MAX], 84, 20));
+
+    //СŲʱŸСȷ
+    TestHold(1);
+    TestRequest(44, 45);
+    TestRequest(100, 10);
+    TestHold(0);
+    ulBase = g_ulMsgs;
+    IpcSyncProcess();
+    TestC28();
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(g_ulMsgs == ulBase + 2);
+    TEST_CHECK(TestMsgRange(&g_psMsg[ulBase % TEST_MSG_MAX], 44, 45));
+    TEST_CHECK(TestMsgRange(&g_psMsg[(ulBase + 1) % TEST_MSG_MAX], 100, 10));
+
+    //ڻѹľʱ鲢飺44..5353..60ͬһϢУ
+    //70..109Ϊ50¼
+    TestHold(1);
+    TestRequest(44, 10);
+    TestRequest(70, 40);
+    TestRequest(53, 8);
+    TestHold(0);
+    ulBase = g_ulMsgs;
+    IpcSyncProcess();
+    TestC28();
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(g_ulMsgs == ulBase + 2);
+    TEST_CHECK(TestMsgRange(&g_psMsg[ulBase % TEST_MSG_MAX], 44, 17));
+    TEST_CHECK(TestMsgRange(&g_psMsg[(ulBase + 1) % TEST_MSG_MAX], 70, 40));
+
+    //ϲ󳬹һϢ飺һϢƹһ
+    TestHold(1);
+    TestRequest(44, 30);
+    TestRequest(73, 31);
+    TestHold(0);
+    ulBase = g_ulMsgs;
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(g_ulMsgs == ulBase + 1);
+    TEST_CHECK((g_psMsg[ulBase % TEST_MSG_MAX].cSource == 'B') &&
+               TestMsgRange(&g_psMsg[ulBase % TEST_MSG_MAX], 44, 60));
+    TEST_CHECK(g_ulIpcLarge == 1);
+
+    //C28ṩַ󣬵IPC-Liteд
+    HWREG(M3_CTOM_PARAMADDR) = TEST_C28_PARAM;
+    ulBase = g_ulMsgs;
+    TestRequest(70, 1);
+    TestC28();
+    TEST_CHECK((g_ulMsgs == ulBase + 1) && (g_psMsg[ulBase % TEST_MSG_MAX].cSource == 'L'));
+    TEST_CHECK(g_psMsg[ulBase % TEST_MSG_MAX].pucIndex[0] == 70);
+    TEST_CHECK(g_ulIpcLiteSent == 1);
+
+    //C28δS0ʱһطճдS1鶼C28ʱٽ
+    //ҲIPC-Lite뻷λC28˳ȡ
+    g_iBlockHold = 1;
+    ulBase = g_ulMsgs;
+    g_ulTickMs += IPC_SYNC_STEP;
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK(HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & IPC_BLOCK_FLAG0);
+    g_ulTickMs += IPC_SYNC_STEP;
+    IpcSyncProcess();
+    TestC28();
+    TEST_CHECK((HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & IPC_BLOCK_FLAGS) == IPC_BLOCK_FLAGS);
+    TEST_CHECK(IpcBlockBusy());
+    g_ulTickMs += IPC_SYNC_STEP;
+    TestRequest(71, 1);
+    TestC28();
+    TEST_CHECK((g_ulMsgs == ulBase) && (g_ulIpcLiteSent == 1));
+    g_iBlockHold = 0;
+    TestC28();
+    TEST_CHECK(g_ulMsgs == ulBase + 5);
+    TEST_CHECK((g_psMsg[ulBase % TEST_MSG_MAX].cSource == 'B') &&
+               (g_psMsg[(ulBase + 3) % TEST_MSG_MAX].cSource == 'B'));
+    TEST_CHECK((g_psMsg[(ulBase + 4) % TEST_MSG_MAX].cSource == 'R') &&
+               TestMsgRange(&g_psMsg[(ulBase + 4) % TEST_MSG_MAX], 71, 1));
+    TEST_CHECK((HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & IPC_BLOCK_FLAGS) == 0);
+
+    return(TestResult("test_ipc_sync"));
+}
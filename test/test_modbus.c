@@ -0,0 +1,167 @@
+/*
+ *     test_modbus.c
+ *
+ *     Modbus RTUдĴԸдfloatֱִУֻдfloat
+ *     6ַĴĹ16Ӧ𣬰ݴ棬
+ *     ͬһһ뵽ŸдParamet
+ *
+ *
+ */
+
+#include "test.h"
+#include "test_port.h"
+#include "crc.h"
+#include "codec.h"
+
+static tSciPort *g_psPort;
+static unsigned char g_pucReply[64];
+static unsigned long g_ulReplyCount;
+
+static void TestTx(tSciPort *psPort, const unsigned char *pucBuf,
+                   unsigned long ulCount)
+{
+    if((psPort == g_psPort) && (ulCount <= sizeof(g_pucReply)))
+    {
+        memcpy(g_pucReply, pucBuf, ulCount);
+        g_ulReplyCount = ulCount;
+    }
+}
+
+//pucFrameеַݣCRCΪһ֡յӦֽ
+static unsigned long TestRequest(unsigned char *pucFrame, unsigned long ulCount)
+{
+    CodecPutU16(&pucFrame[ulCount], CrcModbus(pucFrame, ulCount));
+    g_ulReplyCount = 0;
+    TestPortRx(g_psPort, pucFrame, ulCount + 2);
+    SciModbusRxMark(g_psPort);//ճʱж
+    TestPortRun();
+    TestPortRun();
+    return(g_ulReplyCount);
+}
+
+//16uiStartдuiCountĴֵΪuiValueuiValue+1...
+static unsigned long TestWrite(unsigned int uiStart, unsigned int uiCount,
+                               unsigned int uiValue)
+{
+    unsigned char pucFrame[SCI_RXDATA_MAX];
+    unsigned int i;
+
+    pucFrame[0] = SortNo;
+    pucFrame[1] = 16;
+    CodecPutU16Be(&pucFrame[2], uiStart);
+    CodecPutU16Be(&pucFrame[4], uiCount);
+    pucFrame[6] = 2 * uiCount;
+    for(i = 0; i < uiCount; i++)
+    {
+        CodecPutU16Be(&pucFrame[7 + 2 * i], uiValue + i);
+    }
+    return(TestRequest(pucFrame, 7 + 2 * uiCount));
+}
+
+//6дһĴӦֽ
+static unsigned long TestWriteSingle(unsigned int uiReg, unsigned int uiValue)
+{
+    unsigned char pucFrame[8];
+
+    pucFrame[0] = SortNo;
+    pucFrame[1] = 6;
+    CodecPutU16Be(&pucFrame[2], uiReg);
+    CodecPutU16Be(&pucFrame[4], uiValue);
+    return(TestRequest(pucFrame, 6));
+}
+
+//floatĸ16λ16λ
+static unsigned int TestHigh(float fValue)
+{
+    unsigned char pucValue[4];
+
+    CodecPutFloat(pucValue, fValue);
+    return(CodecGetU16(&pucValue[2]));
+}
+
+static unsigned int TestLow(float fValue)
+{
+    unsigned char pucValue[4];
+
+    CodecPutFloat(pucValue, fValue);
+    return(CodecGetU16(&pucValue[0]));
+}
+
+//ӦΪ쳣uiCode
+static int TestException(unsigned int uiFunction, unsigned int uiCode)
+{
+    return((g_ulReplyCount == 5) && (g_pucReply[1] == (0x80 | uiFunction)) &&
+           (g_pucReply[2] == uiCode));
+}
+
+int main(int argc, char **argv)
+{
+    unsigned char pucFrame[32];
+    unsigned char pucValue[4];
+    unsigned int uiReg = 2 * RunParamNumber;//һò
+    float fNext;
+
+    TestPortInit();
+    g_psPort = g_ppsSciPort[SCI_PORT_UART2];
+    g_pfnTestTx = TestTx;
+    TEST_CHECK(g_psPort->ulFraming == SCI_FRAMING_MODBUS);
+
+    //ԸдĴ2nΪ16λ
+    CodecPutFloat(pucValue, 12.5f);
+    pucFrame[0] = SortNo;
+    pucFrame[1] = 16;
+    CodecPutU16Be(&pucFrame[2], uiReg);
+    CodecPutU16Be(&pucFrame[4], 2);
+    pucFrame[6] = 4;
+    pucFrame[7] = pucValue[3];
+    pucFrame[8] = pucValue[2];
+    pucFrame[9] = pucValue[1];
+    pucFrame[10] = pucValue[0];
+    TEST_CHECK(TestRequest(pucFrame, 11) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] == 12.5f);
+
+    //6һӦճ󵫲дڶ뵽дд16λҲһ
+    TEST_CHECK(TestWriteSingle(uiReg, TestHigh(-3.75f)) == 8);
+    TEST_CHECK((g_pucReply[1] == 6) && (CodecGetU16Be(&g_pucReply[2]) == uiReg));
+    TEST_CHECK(Paramet[RunParamNumber] == 12.5f);
+    TEST_CHECK(TestWriteSingle(uiReg + 1, TestLow(-3.75f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] == -3.75f);
+    TEST_CHECK(TestWriteSingle(uiReg + 1, TestLow(1e6f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] == -3.75f);
+    TEST_CHECK(TestWriteSingle(uiReg, TestHigh(1e6f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] == 1e6f);
+
+    //һİдʱǰݴһ붪
+    fNext = Paramet[RunParamNumber + 1];
+    TEST_CHECK(TestWriteSingle(uiReg, TestHigh(7.0f)) == 8);
+    TEST_CHECK(TestWriteSingle(uiReg + 2, TestHigh(8.0f)) == 8);
+    TEST_CHECK(TestWriteSingle(uiReg + 1, TestLow(7.0f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] != 7.0f);
+    TEST_CHECK(Paramet[RunParamNumber + 1] == fNext);
+    TEST_CHECK(TestWriteSingle(uiReg, TestHigh(7.0f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber] == 7.0f);
+
+    //16ַʼݴһ룬ĩβɶԵļĴݴ
+    TEST_CHECK(TestWriteSingle(uiReg + 2, TestHigh(0.5f)) == 8);
+    pucFrame[1] = 16;
+    CodecPutU16Be(&pucFrame[2], uiReg + 3);
+    CodecPutU16Be(&pucFrame[4], 4);
+    pucFrame[6] = 8;
+    CodecPutU16Be(&pucFrame[7], TestLow(0.5f));
+    CodecPutU16Be(&pucFrame[9], TestHigh(-2.0f));
+    CodecPutU16Be(&pucFrame[11], TestLow(-2.0f));
+    CodecPutU16Be(&pucFrame[13], TestHigh(99.0f));
+    fNext = Paramet[RunParamNumber + 3];
+    TEST_CHECK(TestRequest(pucFrame, 15) == 8);
+    TEST_CHECK(Paramet[RunParamNumber + 1] == 0.5f);
+    TEST_CHECK(Paramet[RunParamNumber + 2] == -2.0f);
+    TEST_CHECK(Paramet[RunParamNumber + 3] == fNext);
+    TEST_CHECK(TestWriteSingle(uiReg + 7, TestLow(99.0f)) == 8);
+    TEST_CHECK(Paramet[RunParamNumber + 3] == 99.0f);
+
+    //ʵʱв쳣02
+    TEST_CHECK(TestWrite(0, 2, 0) == 5);
+    TEST_CHECK(TestException(16, SCI_MODBUS_EX_ADDRESS));
+
+    return(TestResult("test_modbus"));
+}
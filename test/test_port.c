@@ -0,0 +1,143 @@
+/*
+ *     test_port.c
+ *
+ *     ЭԵuDMAIPCԼ֡֡ĸ
+ *
+ *
+ */
+
+#include "test.h"
+#include "test_port.h"
+#include "crc.h"
+#include "ipc_ring.h"
+#include "ipc_sync.h"
+#include "ipc_snap.h"
+
+void (*g_pfnTestTx)(tSciPort *psPort, const unsigned char *pucBuf,
+                    unsigned long ulCount);
+unsigned long g_ulTestIpcCount;
+
+volatile unsigned long g_ulSciDmaErrCount;
+unsigned short g_usIpcSnapSeq;
+
+void SciDmaPortInit(tSciPort *psPort)
+{
+}
+
+//uDMAͣ֡ϣͨᴦæ״̬
+unsigned long SciDmaSend(tSciPort *psPort, const unsigned char *pucBuf,
+                         unsigned long ulCount)
+{
+    if((ulCount == 0) || (ulCount > SCI_DMA_TX_MAX))
+    {
+        return(0);
+    }
+    if(g_pfnTestTx)
+    {
+        g_pfnTestTx(psPort, pucBuf, ulCount);
+    }
+    return(1);
+}
+
+unsigned long SciDmaTxBusy(tSciPort *psPort)
+{
+    return(0);
+}
+
+void SciDmaTxIsr(tSciPort *psPort)
+{
+}
+
+void SciDmaRxIsr(tSciPort *psPort, unsigned long ulStatus)
+{
+}
+
+unsigned long IpcRingPut(const unsigned short *pusMsg, unsigned long ulCount)
+{
+    g_ulTestIpcCount++;
+    return(1);
+}
+
+void IpcSyncMark(unsigned int uiIndex)
+{
+}
+
+void IpcSyncProcess(void)
+{
+}
+
+void TestPortInit(void)
+{
+    SciCmdInit();
+    CrcInit();
+    SciPortInit();
+}
+
+void TestPortRx(tSciPort *psPort, const unsigned char *pucData,
+                unsigned long ulCount)
+{
+    SciStationWrite(psPort, pucData, ulCount);
+    SciStationDrain(psPort);
+}
+
+void TestPortRun(void)
+{
+    SciPortProcess();
+}
+
+unsigned long TestFrame(unsigned char *pucFrame, unsigned char ucSerial,
+                        unsigned char ucCode, const unsigned char *pucData,
+                        unsigned long ulCount)
+{
+    unsigned int uiSum = 0;
+    unsigned long i;
+
+    pucFrame[0] = PackHead;
+    pucFrame[1] = PackHead;
+    pucFrame[2] = PackHead;
+    pucFrame[3] = PackHead;
+    pucFrame[4] = ulCount + 3;
+    pucFrame[5] = ucSerial;
+    pucFrame[6] = ucCode;
+    memcpy(&pucFrame[7], pucData, ulCount);
+    for(i = 4; i < ulCount + 7; i++)
+    {
+        uiSum += pucFrame[i];
+    }
+    pucFrame[ulCount + 7] = (~uiSum) + 1;
+    return(ulCount + 8);
+}
+
+unsigned long TestFrameFind(const unsigned char *pucBuf, unsigned long ulCount,
+                            const unsigned char **ppucBody)
+{
+    unsigned long ulLength;
+    unsigned long i;
+    unsigned long j;
+    unsigned char ucSum;
+
+    for(i = 0; i + 5 <= ulCount; i++)
+    {
+        if((pucBuf[i] != PackHead) || (pucBuf[i + 1] != PackHead) ||
+           (pucBuf[i + 2] != PackHead) || (pucBuf[i + 3] != PackHead))
+        {
+            continue;
+        }
+        ulLength = pucBuf[i + 4];
+        if((ulLength < SCI_PACK_MIN) || (i + 5 + ulLength > ulCount))
+        {
+            continue;
+        }
+        ucSum = 0;
+        for(j = 0; j <= ulLength; j++)
+        {
+            ucSum += pucBuf[i + 4 + j];
+        }
+        if(ucSum == 0)
+        {
+            *ppucBody = &pucBuf[i + 5];
+            return(ulLength);
+        }
+    }
+    return(0);
+}
@@ -0,0 +1,30 @@
+#ifndef __TEST_PORT_H__
+#define __TEST_PORT_H__
+
+//----------------------------------Э
+//message.csci_port.cЭģ飬uDMAC28IPCtest_port.c
+//յֽھSciStationWrite()д˿ڣSciDmaSend()֡
+#include "global_var.h"
+#include "sci_port.h"
+
+//SciDmaSend()ÿһ֡Ϊ0ʱ
+extern void (*g_pfnTestTx)(tSciPort *psPort, const unsigned char *pucBuf,
+                           unsigned long ulCount);
+extern unsigned long g_ulTestIpcCount; //IpcRingPut()յϢ
+
+//main()е˳ʼCRC˿
+extern void TestPortInit(void);
+//ֽڴӶ˿ڵUARTյ
+extern void TestPortRx(tSciPort *psPort, const unsigned char *pucData,
+                       unsigned long ulCount);
+//ѭһ
+extern void TestPortRun(void);
+//ɺУֽͨ֡֡
+extern unsigned long TestFrame(unsigned char *pucFrame, unsigned char ucSerial,
+                               unsigned char ucCode, const unsigned char *pucData,
+                               unsigned long ulCount);
+//pucBufҵһУȷͨ֡кȣУ飩Ҳʱ0
+extern unsigned long TestFrameFind(const unsigned char *pucBuf, unsigned long ulCount,
+                                   const unsigned char **ppucBody);
+
+#endif
@@ -0,0 +1,197 @@
+/*
+ *     test_resync.c
+ *
+ *     ͬתλUART0˿ڣ
+ *     ͳδӰ֡еõӦıܲʱÿָ֡
+ *
+ *
+ */
+
+#include <stdlib.h>
+#include "test.h"
+#include "test_port.h"
+
+#define TEST_RESYNC_FRAMES 5000     //ܼ֡
+#define TEST_RESYNC_BENCH 200000    //ܲԵ֡
+#define TEST_RESYNC_PAIRS (100 * 128)
+
+static tSciPort *g_psPort;
+static unsigned char g_pucAnswered[TEST_RESYNC_PAIRS]; //к+¼յӦ
+static unsigned long g_ulTestTxCount;
+
+//i֡к룬TEST_RESYNC_PAIRS֡ڲظ
+static unsigned long TestPair(unsigned long i)
+{
+    return(i % TEST_RESYNC_PAIRS);
+}
+
+static void TestTx(tSciPort *psPort, const unsigned char *pucBuf,
+                   unsigned long ulCount)
+{
+    const unsigned char *pucBody;
+
+    if(psPort != g_psPort)
+    {
+        return;
+    }
+    g_ulTestTxCount++;
+    if(TestFrameFind(pucBuf, ulCount, &pucBody) && (pucBody[0] < 100) &&
+       (pucBody[1] < 128))
+    {
+        g_pucAnswered[pucBody[1] * 100 + pucBody[0]] = 1;
+    }
+}
+
+//ж
+static void TestDrain(void)
+{
+    unsigned long i;
+
+    for(i = 0; i < 64; i++)
+    {
+        TestPortRun();
+        if((SciRingCount(&g_psPort->sRxRing) == 0) &&
+           (g_psPort->ulRxPendHead == g_psPort->ulRxPendTail) &&
+           (g_psPort->ulReqHead == g_psPort->ulReqTail))
+        {
+            break;
+        }
+    }
+}
+
+//dBerλתطתλ
+static unsigned long TestInject(unsigned char *pucData, unsigned long ulCount,
+                                double dBer, unsigned int *puiSeed)
+{
+    unsigned long ulFlip = 0;
+    unsigned long i;
+    unsigned long ulBit;
+
+    if(dBer <= 0)
+    {
+        return(0);
+    }
+    for(i = 0; i < ulCount; i++)
+    {
+        for(ulBit = 0; ulBit < 8; ulBit++)
+        {
+            if(rand_r(puiSeed) < dBer * ((double)RAND_MAX + 1))
+            {
+                pucData[i] ^= 1 << ulBit;
+                ulFlip++;
+            }
+        }
+    }
+    return(ulFlip);
+}
+
+//ulFrames󣬷δӰ֡еõӦı*pulRecoveredΪ
+static double TestRun(unsigned long ulFrames, double dBer, unsigned long *pulRecovered,
+                      double *pdTime)
+{
+    static unsigned char pucClean[TEST_RESYNC_PAIRS];
+    static unsigned char pucStream[TEST_RESYNC_PAIRS][8]; //Ϊ8ֽ
+    unsigned int uiSeed = 12345;
+    unsigned long ulClean = 0;
+    unsigned long ulRecovered = 0;
+    unsigned long ulPair;
+    unsigned long ulDone;
+    unsigned long i;
+    double dStart;
+
+    memset(g_pucAnswered, 0, sizeof(g_pucAnswered));
+    memset(pucClean, 0, sizeof(pucClean));
+    *pdTime = 0;
+    for(ulDone = 0; ulDone < ulFrames; ulDone += TEST_RESYNC_PAIRS)
+    {
+        //ɲע룬ʱֻմ
+        for(i = ulDone; (i < ulFrames) && (i < ulDone + TEST_RESYNC_PAIRS); i++)
+        {
+            ulPair = TestPair(i);
+            TestFrame(pucStream[ulPair], ulPair % 100, ulPair / 100, 0, 0);
+            pucClean[ulPair] = (TestInject(pucStream[ulPair], 8, dBer, &uiSeed) == 0);
+        }
+        dStart = TestNow();
+        for(i = ulDone; (i < ulFrames) && (i < ulDone + TEST_RESYNC_PAIRS); i++)
+        {
+            TestPortRx(g_psPort, pucStream[TestPair(i)], 8);
+            TestDrain();
+        }
+        //ĩβδֽ֡ڼʱ
+        g_ulTickMs += 100;
+        TestDrain();
+        *pdTime += TestNow() - dStart;
+
+        for(ulPair = 0; ulPair < TEST_RESYNC_PAIRS; ulPair++)
+        {
+            if(pucClean[ulPair])
+            {
+                ulClean++;
+                ulRecovered += g_pucAnswered[ulPair];
+            }
+        }
+        memset(g_pucAnswered, 0, sizeof(g_pucAnswered));
+        memset(pucClean, 0, sizeof(pucClean));
+    }
+    *pulRecovered = ulRecovered;
+    return(ulClean ? (double)ulRecovered / ulClean : 1.0);
+}
+
+//ȷΣ֡ͷضϵд֮֡
+static void TestCases(void)
+{
+    unsigned char pucBuf[64];
+    unsigned long ulCount;
+
+    ulCount = TestFrame(pucBuf, 1, 0x10, 0, 0);
+    pucBuf[4] = 9;//
+    ulCount = 5 + TestFrame(&pucBuf[5], 2, 0x11, 0, 0);
+    memset(g_pucAnswered, 0, sizeof(g_pucAnswered));
+    TestPortRx(g_psPort, pucBuf, ulCount);
+    TestDrain();
+    g_ulTickMs += 100;
+    TestDrain();
+    TEST_CHECK(g_pucAnswered[0x11 * 100 + 2]);
+
+    ulCount = TestFrame(pucBuf, 3, 0x10, (const unsigned char *)"\1\2\3\4", 4);
+    ulCount = 6 + TestFrame(&pucBuf[6], 4, 0x12, 0, 0);//дֻǰ6ֽ
+    TestPortRx(g_psPort, pucBuf, ulCount);
+    TestDrain();
+    g_ulTickMs += 100;
+    TestDrain();
+    TEST_CHECK(g_pucAnswered[0x12 * 100 + 4]);
+}
+
+int main(int argc, char **argv)
+{
+    static const double pdBer[] = { 0, 1e-4, 1e-3, 1e-2 };
+    unsigned long ulRecovered;
+    unsigned long ulFrames;
+    unsigned long i;
+    double dRatio;
+    double dTime;
+
+    TestPortInit();
+    g_psPort = g_ppsSciPort[SCI_PORT_UART0];
+    g_pfnTestTx = TestTx;
+
+    TestCases();
+
+    //ûʱȫӦʱδӰ֡ȫָУ1/256ĻѴ֡ȷ֡
+    TEST_CHECK(TestRun(TEST_RESYNC_FRAMES, 0, &ulRecovered, &dTime) == 1.0);
+    TEST_CHECK(TestRun(TEST_RESYNC_FRAMES, 1e-3, &ulRecovered, &dTime) >= 0.99);
+    TEST_CHECK(TestRun(TEST_RESYNC_FRAMES, 1e-2, &ulRecovered, &dTime) >= 0.95);
+
+    if(TestBench(argc, argv))
+    {
+        ulFrames = TEST_RESYNC_BENCH;
+        printf("resync: %lu frames per rate (host)\n", ulFrames);
+        for(i = 0; i < sizeof(pdBer) / sizeof(pdBer[0]); i++)
+        {
+            dRatio = TestRun(ulFrames, pdBer[i], &ulRecovered, &dTime);
+            printf("  ber %.0e: %.2f%% of clean frames recovered, %.0f recovered frames/s\n",
+                   pdBer[i], dRatio * 100, ulRecovered / dTime);
+        }
+    }
+    return(TestResult("test_resync"));
+}
@@ -0,0 +1,281 @@
+/*
+ *     test_ring.c
+ *
+ *     SCIջλơʱĹܼ飻жϵʵ·
+ *     uDMAƹһ -> վŹ -> λд˳ת֡βͬFIFOʣֽת
+ *     ̰ܲ߳齻SciDmaRxIsr()UARTжϣѭֽڶ˶ԣ
+ *     ͳƳʺSciDmaRxIsr()תһ顢ת֡βĺʱ
+ *
+ *
+ */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <string.h>
+#include "test.h"
+#include "global_var.h"
+#include "sci_port.h"
+#include "hw_memmap.h"
+#include "hw_types.h"
+#include "uart.h"
+#include "udma.h"
+
+#define TEST_STREAM_BYTES (16UL << 20)  //ܲԵֽ
+#define TEST_ISR_RUNS 100000            //SciDmaRxIsr()Ĵ
+//֡βֽڣвһͻFIFOв㴥ȵʣֽ
+#define TEST_TAIL_DMA (SCI_DMA_RX_SIZE - 8)
+#define TEST_TAIL_FIFO 11
+
+static unsigned long long g_pullCycles[TEST_ISR_RUNS];
+
+static tSciRing g_sRing;
+
+//ԵӵUART1ֻsci_dma.csci_station.csci_ring.c·̼ͬ
+static const tSciPortConfig g_sTestConfig =
+{
+    UART1_BASE, 0, 0, 0,
+    0, 0, 0,
+    0, 0,
+    UDMA_CHANNEL_UART1RX, UDMA_CHANNEL_UART1TX, 0,
+    0, 0, 0,
+    SCI_FRAMING_FE
+};
+static tSciPort g_sPort;
+tSciPort *const g_ppsSciPort[SCI_PORT_NUM] = { &g_sPort, &g_sPort, &g_sPort };
+
+void SciModbusRxMark(tSciPort *psPort)
+{
+}
+
+static void TestPortReset(void)
+{
+    g_sPort.psConfig = &g_sTestConfig;
+    g_sPort.uiSortNumber = SortNo;
+    SciRingInit(&g_sPort.sRxRing);
+    SciStationInit(&g_sPort);
+    SciDmaPortInit(&g_sPort);
+}
+
+//֡(FE FE FE FE 03 к  У)ɵֽulPosֽ
+static unsigned char TestStreamByte(unsigned long ulPos)
+{
+    unsigned long ulFrame = ulPos >> 3;
+    unsigned char ucSerial = (unsigned char)ulFrame;
+
+    switch(ulPos & 7)
+    {
+    case 4:
+        return(3);
+    case 5:
+        return(ucSerial);
+    case 6:
+        return(0x10);
+    case 7:
+        return((unsigned char)-(3 + ucSerial + 0x10));
+    default:
+        return(0xFE);
+    }
+}
+
+static void TestRingBasic(void)
+{
+    unsigned char pucData[SCI_RING_SIZE + 8];
+    unsigned char ucData;
+    unsigned long i;
+
+    SciRingInit(&g_sRing);
+    TEST_CHECK(SciRingGet(&g_sRing, &ucData) == 0);
+
+    //λƣ˳дͬ
+    for(i = 0; i < 10 * SCI_RING_SIZE; i++)
+    {
+        TEST_CHECK(SciRingPut(&g_sRing, (unsigned char)i) == 1);
+        TEST_CHECK(SciRingCount(&g_sRing) == 1);
+        TEST_CHECK(SciRingGet(&g_sRing, &ucData) == 1);
+        TEST_CHECK(ucData == (unsigned char)i);
+    }
+
+    //д
+    for(i = 0; i < SCI_RING_SIZE; i++)
+    {
+        TEST_CHECK(SciRingPut(&g_sRing, (unsigned char)i) == 1);
+    }
+    TEST_CHECK(SciRingPut(&g_sRing, 0) == 0);
+    TEST_CHECK(g_sRing.ulDrop == 1);
+    for(i = 0; i < SCI_RING_SIZE; i++)
+    {
+        TEST_CHECK(SciRingGet(&g_sRing, &ucData) == 1);
+        TEST_CHECK(ucData == (unsigned char)i);
+    }
+
+    //ɿд볬пռʱֻдܷµĲ
+    SciRingInit(&g_sRing);
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        pucData[i] = (unsigned char)(i * 7);
+    }
+    SciRingWrite(&g_sRing, pucData, 10);
+    SciRingWrite(&g_sRing, pucData + 10, sizeof(pucData) - 10);
+    TEST_CHECK(SciRingCount(&g_sRing) == SCI_RING_SIZE);
+    TEST_CHECK(g_sRing.ulDrop == 8);
+    for(i = 0; i < SCI_RING_SIZE; i++)
+    {
+        TEST_CHECK(SciRingGet(&g_sRing, &ucData) && (ucData == pucData[i]));
+    }
+
+}
+
+//жϵʵ·дĿ鰴˳תճʱʱתһֽںFIFOʣֽ
+static void TestRingDma(void)
+{
+    unsigned long ulChannel = g_sTestConfig.ulDmaRx;
+    unsigned char pucData[3 * SCI_DMA_RX_SIZE + 24];
+    unsigned char ucData;
+    unsigned long i;
+
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        pucData[i] = TestStreamByte(i);
+    }
+    TestPortReset();
+
+    //дһ
+    TEST_CHECK(TestDmaRx(ulChannel, pucData, SCI_DMA_RX_SIZE) == SCI_DMA_RX_SIZE);
+    SciDmaRxIsr(&g_sPort, 0);
+    TEST_CHECK(SciRingCount(&g_sPort.sRxRing) == SCI_DMA_RX_SIZE);
+
+    //ж鶼дֹͨͣתдһ飬´ͨ
+    TEST_CHECK(TestDmaRx(ulChannel, &pucData[SCI_DMA_RX_SIZE], 2 * SCI_DMA_RX_SIZE) ==
+               2 * SCI_DMA_RX_SIZE);
+    TEST_CHECK(!uDMAChannelIsEnabled(ulChannel));
+    SciDmaRxIsr(&g_sPort, 0);
+    TEST_CHECK(uDMAChannelIsEnabled(ulChannel));
+
+    //֡β16ֽڣFIFO8ֽ
+    TEST_CHECK(TestDmaRx(ulChannel, &pucData[3 * SCI_DMA_RX_SIZE], 16) == 16);
+    TestUartFeed(&pucData[3 * SCI_DMA_RX_SIZE + 16], 8);
+    SciDmaRxIsr(&g_sPort, UART_INT_RT);
+    TEST_CHECK(TestUartCount() == 0);
+
+    TEST_CHECK(SciRingCount(&g_sPort.sRxRing) == sizeof(pucData));
+    for(i = 0; i < sizeof(pucData); i++)
+    {
+        TEST_CHECK(SciRingGet(&g_sPort.sRxRing, &ucData) && (ucData == pucData[i]));
+    }
+}
+
+//ߣջŵһʱдһ鲢жϣóCPU
+//ʵжϲȴ˴ֽԱ˶ԣ
+static void *TestProducer(void *pvArg)
+{
+    unsigned char pucBlock[SCI_DMA_RX_SIZE];
+    unsigned long ulPos = 0;
+    unsigned long i;
+
+    while(ulPos < TEST_STREAM_BYTES)
+    {
+        if((SCI_RING_SIZE - SciRingCount(&g_sPort.sRxRing)) < SCI_DMA_RX_SIZE)
+        {
+            sched_yield();
+            continue;
+        }
+        for(i = 0; i < SCI_DMA_RX_SIZE; i++)
+        {
+            pucBlock[i] = TestStreamByte(ulPos + i);
+        }
+        TestDmaRx(g_sTestConfig.ulDmaRx, pucBlock, SCI_DMA_RX_SIZE);
+        SciDmaRxIsr(&g_sPort, 0);
+        ulPos += SCI_DMA_RX_SIZE;
+    }
+    return(0);
+}
+
+static int TestCompare(const void *pvA, const void *pvB)
+{
+    unsigned long long ullA = *(const unsigned long long *)pvA;
+    unsigned long long ullB = *(const unsigned long long *)pvB;
+
+    return((ullA > ullB) - (ullA < ullB));
+}
+
+//һνжϵĺʱÿȾuDMAFIFOulDmaulFifoֽڣټʱSciDmaRxIsr()
+//ֽһΣվŹ֡УdriverlibĿ
+static void TestIsrCycles(const char *pcName, unsigned long ulDma, unsigned long ulFifo,
+                          unsigned long ulStatus)
+{
+    unsigned char pucData[SCI_DMA_RX_SIZE + TEST_TAIL_FIFO];
+    unsigned long long ullStart;
+    unsigned long ulPos = 0;
+    unsigned long i;
+    unsigned long j;
+
+    TestPortReset();
+    for(i = 0; i < TEST_ISR_RUNS; i++)
+    {
+        for(j = 0; j < ulDma + ulFifo; j++)
+        {
+            pucData[j] = TestStreamByte(ulPos++);
+        }
+        TestDmaRx(g_sTestConfig.ulDmaRx, pucData, ulDma);
+        TestUartFeed(&pucData[ulDma], ulFifo);
+        ullStart = TestCycles();
+        SciDmaRxIsr(&g_sPort, ulStatus);
+        g_pullCycles[i] = TestCycles() - ullStart;
+        g_sPort.sRxRing.ulTail = g_sPort.sRxRing.ulHead;
+    }
+    TEST_CHECK(g_sPort.sRxRing.ulDrop == 0);
+    //ֵϵͳȵĸţͬʱ99.9%λ
+    qsort(g_pullCycles, TEST_ISR_RUNS, sizeof(g_pullCycles[0]), TestCompare);
+    printf("isr %s (%lu+%lu bytes): median %llu, 99.9%% %llu, worst %llu host cycles\n",
+           pcName, ulDma, ulFifo, g_pullCycles[TEST_ISR_RUNS / 2],
+           g_pullCycles[TEST_ISR_RUNS - TEST_ISR_RUNS / 1000],
+           g_pullCycles[TEST_ISR_RUNS - 1]);
+}
+
+static void TestRingBench(void)
+{
+    pthread_t sThread;
+    unsigned char ucData;
+    unsigned long ulPos = 0;
+    unsigned long ulError = 0;
+    double dStart;
+    double dTime;
+
+    TestPortReset();
+    dStart = TestNow();
+    pthread_create(&sThread, 0, TestProducer, 0);
+    while(ulPos < TEST_STREAM_BYTES)
+    {
+        if(!SciRingGet(&g_sPort.sRxRing, &ucData))
+        {
+            sched_yield();
+            continue;
+        }
+        if(ucData != TestStreamByte(ulPos))
+        {
+            ulError++;
+        }
+        ulPos++;
+    }
+    pthread_join(sThread, 0);
+    dTime = TestNow() - dStart;
+    TEST_CHECK(ulError == 0);
+    TEST_CHECK(g_sPort.sRxRing.ulDrop == 0);
+    printf("ring: %lu bytes in %.3f s, %.1f MB/s, %lu errors\n",
+           TEST_STREAM_BYTES, dTime, TEST_STREAM_BYTES / dTime / 1e6, ulError);
+
+    TestIsrCycles("block", SCI_DMA_RX_SIZE, 0, 0);
+    TestIsrCycles("frame end", TEST_TAIL_DMA, TEST_TAIL_FIFO, UART_INT_RT);
+}
+
+int main(int argc, char **argv)
+{
+    TestRingBasic();
+    TestRingDma();
+    if(TestBench(argc, argv))
+    {
+        TestRingBench();
+    }
+    return(TestResult("test_ring"));
+}
@@ -0,0 +1,124 @@
+/*
+ *     test_station.c
+ *
+ *     վŹ֡ͷ飺FEδı־λ֮ȷ̵ܱ֡
+ *     վ֡ڹƹʱSciRxByte()
+ *
+ *
+ */
+
+#include "test.h"
+#include "test_port.h"
+
+static tSciPort *g_psPort;
+static unsigned long g_ulTestTxCount;
+
+static void TestTx(tSciPort *psPort, const unsigned char *pucBuf,
+                   unsigned long ulCount)
+{
+    if(psPort == g_psPort)
+    {
+        g_ulTestTxCount++;
+    }
+}
+
+//չ֡ulStationΪSCI_STATION_NONEʱվ
+static unsigned long TestLongRead(unsigned char *pucFrame, unsigned long ulFlags,
+                                  unsigned long ulStation)
+{
+    unsigned long ulCount = 0;
+    unsigned int uiSum = 0;
+    unsigned long i;
+
+    for(i = 0; i < PackHeadLength; i++)
+    {
+        pucFrame[ulCount++] = PackHead;
+    }
+    pucFrame[ulCount++] = SCI_LONG_FRAME;
+    pucFrame[ulCount++] = ulFlags;
+    pucFrame[ulCount++] = 3;
+    pucFrame[ulCount++] = 0;
+    if(ulStation != SCI_STATION_NONE)
+    {
+        pucFrame[ulCount++] = ulStation;
+    }
+    pucFrame[ulCount++] = 0;    //к
+    pucFrame[ulCount++] = 0x10; //
+    for(i = PackHeadLength; i < ulCount; i++)
+    {
+        uiSum += pucFrame[i];
+    }
+    pucFrame[ulCount++] = (~uiSum) + 1;
+    return(ulCount);
+}
+
+//һֽڣزӦ֡
+static unsigned long TestFeed(const unsigned char *pucData, unsigned long ulCount)
+{
+    g_ulTestTxCount = 0;
+    TestPortRx(g_psPort, pucData, ulCount);
+    TestPortRun();
+    TestPortRun();
+    return(g_ulTestTxCount);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned char pucBuf[128];
+    unsigned long ulCount;
+    unsigned long ulSkip;
+
+    TestPortInit();
+    g_psPort = g_ppsSciPort[SCI_PORT_UART0];
+    g_pfnTestTx = TestTx;
+
+    //ͨ֡ʹվŵչ֡
+    ulCount = TestFrame(pucBuf, 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+    ulCount = TestLongRead(pucBuf, SCI_FLAG_STATION, SortNo);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+
+    //ͷǰһFE
+    pucBuf[0] = PackHead;
+    ulCount = 1 + TestFrame(&pucBuf[1], 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+
+    //SCI_RXDATA_MAXֽܰ
+    pucBuf[0] = pucBuf[1] = pucBuf[2] = pucBuf[3] = PackHead;
+    pucBuf[4] = SCI_RXDATA_MAX + 1;
+    ulCount = 5 + TestFrame(&pucBuf[5], 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+
+    //־δλԼչ֡
+    ulCount = TestLongRead(pucBuf, 0x80, SCI_STATION_NONE);
+    ulCount += TestFrame(&pucBuf[ulCount], 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+    ulCount = TestLongRead(pucBuf, 0, SCI_STATION_NONE);
+    pucBuf[7] = 1;//256+3
+    ulCount = 8 + TestFrame(&pucBuf[8], 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+
+    //վ֡֡㲥֡յӦ
+    ulSkip = g_psPort->ulStationSkip;
+    ulCount = TestLongRead(pucBuf, SCI_FLAG_STATION, SortNo + 1);
+    ulCount += TestFrame(&pucBuf[ulCount], 0, 0x10, 0, 0);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 1);
+    TEST_CHECK(g_psPort->ulStationSkip == ulSkip + 1);
+    ulCount = TestLongRead(pucBuf, SCI_FLAG_STATION, SCI_STATION_BROADCAST);
+    TEST_CHECK(TestFeed(pucBuf, ulCount) == 0);
+
+    //ƹֱд뻷λSciRxByte()վŶ
+    ulCount = TestLongRead(pucBuf, SCI_FLAG_STATION, SortNo + 1);
+    SciRingWrite(&g_psPort->sRxRing, pucBuf, ulCount);
+    g_ulTestTxCount = 0;
+    TestPortRun();
+    TestPortRun();
+    TEST_CHECK(g_ulTestTxCount == 0);
+    ulCount = TestLongRead(pucBuf, SCI_FLAG_STATION, SortNo);
+    SciRingWrite(&g_psPort->sRxRing, pucBuf, ulCount);
+    TestPortRun();
+    TestPortRun();
+    TEST_CHECK(g_ulTestTxCount == 1);
+
+    return(TestResult("test_station"));
+}
@@ -0,0 +1,385 @@
+/*
+ *     test_stub.c
+ *
+ *     õdriverlibUARTFIFOģ⣬UART¼õĲʣ
+ *     uDMAֻģƹҽգֽTestDmaRx()룩uCRC0CrcInit()ѡCRC
+ *     躯Ϊղ
+ *
+ *
+ */
+
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "test.h"
+#include "hw_types.h"
+#include "uart.h"
+#include "gpio.h"
+#include "interrupt.h"
+#include "ram.h"
+#include "sysctl.h"
+#include "ucrc.h"
+#include "udma.h"
+#include "ipc.h"
+#include "hw_memmap.h"
+#include "hw_ipc.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+unsigned long g_ulTestFail = 0;
+
+#define TEST_UART_SIZE 4096
+
+static unsigned char g_pucTestUart[TEST_UART_SIZE];
+static unsigned long g_ulTestUartHead;
+static unsigned long g_ulTestUartTail;
+static unsigned long g_pulTestUartBaud[16]; //UARTַĵ12~15λ
+static tBoolean g_bTestIntMasked;
+
+//ϢRAMIPCĴڵҳӳΪڴ棨㣩HWREG()Щַٳ
+//unsigned longΪ64λMTOC_PASSMSG[3]±껻ĵַᳬM3ϵķΧӳһҳ
+int TestMsgRamMap(void)
+{
+    static const unsigned long pulPage[][2] =
+    {
+        { 0x2007F000, 0x2000 }, //CTOM/MTOCϢRAM
+        { 0x400FB000, 0x1000 }, //IPCĴ
+    };
+    unsigned long i;
+    void *pvPage;
+
+    for(i = 0; i < sizeof(pulPage) / sizeof(pulPage[0]); i++)
+    {
+        pvPage = mmap((void *)pulPage[i][0], pulPage[i][1], PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if(pvPage != (void *)pulPage[i][0])
+        {
+            return(0);
+        }
+    }
+    return(1);
+}
+
+//IPCĴдMTOCIPCSETλMTOCIPCFLGӲԶɣӳڴҳҪֶ
+void TestIpcSet(void)
+{
+    HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) |= HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCSET);
+    HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCSET) = 0;
+}
+
+//-bʱܲ
+int TestBench(int argc, char **argv)
+{
+    return((argc > 1) && (strcmp(argv[1], "-b") == 0));
+}
+
+int TestResult(const char *pcName)
+{
+    printf("%s: %s\n", pcName, g_ulTestFail ? "FAIL" : "ok");
+    return(g_ulTestFail ? 1 : 0);
+}
+
+//ʱӣs
+double TestNow(void)
+{
+    struct timespec sTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &sTime);
+    return(sTime.tv_sec + sTime.tv_nsec * 1e-9);
+}
+
+//ʱڼx86ʱns
+unsigned long long TestCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return(__rdtsc());
+#else
+    return((unsigned long long)(TestNow() * 1e9));
+#endif
+}
+
+void TestUartFeed(const unsigned char *pucData, unsigned long ulCount)
+{
+    while(ulCount--)
+    {
+        g_pucTestUart[g_ulTestUartHead++ % TEST_UART_SIZE] = *pucData++;
+    }
+}
+
+unsigned long TestUartCount(void)
+{
+    return(g_ulTestUartHead - g_ulTestUartTail);
+}
+
+tBoolean UARTCharsAvail(unsigned long ulBase)
+{
+    return(g_ulTestUartHead != g_ulTestUartTail);
+}
+
+long UARTCharGetNonBlocking(unsigned long ulBase)
+{
+    if(g_ulTestUartHead == g_ulTestUartTail)
+    {
+        return(-1);
+    }
+    return(g_pucTestUart[g_ulTestUartTail++ % TEST_UART_SIZE]);
+}
+
+unsigned long TestUartBaud(unsigned long ulBase)
+{
+    return(g_pulTestUartBaud[(ulBase >> 12) & 0xF]);
+}
+
+void UARTConfigSetExpClk(unsigned long ulBase, unsigned long ulUARTClk,
+                         unsigned long ulBaud, unsigned long ulConfig)
+{
+    g_pulTestUartBaud[(ulBase >> 12) & 0xF] = ulBaud;
+}
+
+//ɣλĴǿյ
+tBoolean UARTBusy(unsigned long ulBase)
+{
+    return(false);
+}
+
+void UARTFIFOLevelSet(unsigned long ulBase, unsigned long ulTxLevel,
+                      unsigned long ulRxLevel)
+{
+}
+
+void UARTIntEnable(unsigned long ulBase, unsigned long ulIntFlags)
+{
+}
+
+void UARTIntDisable(unsigned long ulBase, unsigned long ulIntFlags)
+{
+}
+
+unsigned long UARTIntStatus(unsigned long ulBase, tBoolean bMasked)
+{
+    return(0);
+}
+
+void UARTIntClear(unsigned long ulBase, unsigned long ulIntFlags)
+{
+}
+
+unsigned long UARTRxErrorGet(unsigned long ulBase)
+{
+    return(0);
+}
+
+void UARTRxErrorClear(unsigned long ulBase)
+{
+}
+
+void UARTTxIntModeSet(unsigned long ulBase, unsigned long ulMode)
+{
+}
+
+void UARTDMAEnable(unsigned long ulBase, unsigned long ulDMAFlags)
+{
+}
+
+//uDMAͨƽṹһͨźUDMA_ALT_SELECT
+typedef struct
+{
+    unsigned char *pucDst;
+    unsigned long ulSize;   //ʣֽ
+    unsigned long ulMode;
+} tTestDmaCtl;
+
+static tTestDmaCtl g_psTestDma[32][2];
+static unsigned long g_pulTestDmaSel[32];  //ڴĿƽṹ
+static unsigned long g_ulTestDmaEnable;
+
+static tTestDmaCtl *TestDmaCtl(unsigned long ulChannelStructIndex)
+{
+    return(&g_psTestDma[ulChannelStructIndex & 0x1F]
+                       [(ulChannelStructIndex & UDMA_ALT_SELECT) ? 1 : 0]);
+}
+
+unsigned long TestDmaRx(unsigned long ulChannel, const unsigned char *pucData,
+                        unsigned long ulCount)
+{
+    tTestDmaCtl *psCtl;
+    unsigned long ulDone = 0;
+
+    ulChannel &= 0x1F;
+    while((ulDone < ulCount) && (g_ulTestDmaEnable & (1UL << ulChannel)))
+    {
+        psCtl = &g_psTestDma[ulChannel][g_pulTestDmaSel[ulChannel]];
+        *psCtl->pucDst++ = pucData[ulDone++];
+        if(--psCtl->ulSize == 0)
+        {
+            //ƹңдһתһ飬һδװʱֹͨͣ
+            psCtl->ulMode = UDMA_MODE_STOP;
+            g_pulTestDmaSel[ulChannel] ^= 1;
+            if(g_psTestDma[ulChannel][g_pulTestDmaSel[ulChannel]].ulMode == UDMA_MODE_STOP)
+            {
+                g_ulTestDmaEnable &= ~(1UL << ulChannel);
+            }
+        }
+    }
+    return(ulDone);
+}
+
+void uDMAEnable(void)
+{
+}
+
+void uDMAControlBaseSet(void *pControlTable)
+{
+}
+
+unsigned long uDMAErrorStatusGet(void)
+{
+    return(0);
+}
+
+void uDMAErrorStatusClear(void)
+{
+}
+
+void uDMAChannel8_15SelectAltMapping(unsigned long ulAltPeriphs)
+{
+}
+
+void uDMAChannelAttributeEnable(unsigned long ulChannelNum, unsigned long ulAttr)
+{
+}
+
+//UDMA_ATTR_ALTSELECTһδƽṹʼ
+void uDMAChannelAttributeDisable(unsigned long ulChannelNum, unsigned long ulAttr)
+{
+    if(ulAttr & UDMA_ATTR_ALTSELECT)
+    {
+        g_pulTestDmaSel[ulChannelNum & 0x1F] = 0;
+    }
+}
+
+void uDMAChannelControlSet(unsigned long ulChannelStructIndex, unsigned long ulControl)
+{
+}
+
+void uDMAChannelTransferSet(unsigned long ulChannelStructIndex, unsigned long ulMode,
+                            void *pvSrcAddr, void *pvDstAddr,
+                            unsigned long ulTransferSize)
+{
+    tTestDmaCtl *psCtl = TestDmaCtl(ulChannelStructIndex);
+
+    psCtl->pucDst = pvDstAddr;
+    psCtl->ulSize = ulTransferSize;
+    psCtl->ulMode = ulMode;
+}
+
+unsigned long uDMAChannelSizeGet(unsigned long ulChannelStructIndex)
+{
+    return(TestDmaCtl(ulChannelStructIndex)->ulSize);
+}
+
+unsigned long uDMAChannelModeGet(unsigned long ulChannelStructIndex)
+{
+    return(TestDmaCtl(ulChannelStructIndex)->ulMode);
+}
+
+void uDMAChannelEnable(unsigned long ulChannelNum)
+{
+    g_ulTestDmaEnable |= 1UL << (ulChannelNum & 0x1F);
+}
+
+void uDMAChannelDisable(unsigned long ulChannelNum)
+{
+    g_ulTestDmaEnable &= ~(1UL << (ulChannelNum & 0x1F));
+}
+
+tBoolean uDMAChannelIsEnabled(unsigned long ulChannelNum)
+{
+    return((g_ulTestDmaEnable >> (ulChannelNum & 0x1F)) & 1);
+}
+
+void GPIOPinConfigure(unsigned long ulPinConfig)
+{
+}
+
+void GPIOPinTypeUART(unsigned long ulPort, unsigned char ucPins)
+{
+}
+
+void GPIOPinTypeGPIOOutput(unsigned long ulPort, unsigned char ucPins)
+{
+}
+
+void GPIOPinWrite(unsigned long ulPort, unsigned char ucPins, unsigned char ucVal)
+{
+}
+
+tBoolean IntMasterDisable(void)
+{
+    tBoolean bMasked = g_bTestIntMasked;
+
+    g_bTestIntMasked = true;
+    return(bMasked);
+}
+
+tBoolean IntMasterEnable(void)
+{
+    tBoolean bMasked = g_bTestIntMasked;
+
+    g_bTestIntMasked = false;
+    return(bMasked);
+}
+
+void IntRegister(unsigned long ulInterrupt, void (*pfnHandler)(void))
+{
+}
+
+void IntEnable(unsigned long ulInterrupt)
+{
+}
+
+void RAMMReqSharedMemAccess(unsigned long ulMask, unsigned short usMaster)
+{
+}
+
+void SysCtlPeripheralEnable(unsigned long ulPeripheral)
+{
+}
+
+unsigned long SysCtlClockGet(unsigned long ulClockIn)
+{
+    return(75000000);
+}
+
+void UCRCClear(unsigned long ulBase)
+{
+}
+
+void UCRCConfig(unsigned long ulBase, unsigned long ulType)
+{
+}
+
+unsigned long UCRCCalculation(unsigned long ulBase, unsigned long ulType,
+                              unsigned char *pucBuffer, unsigned long ulNumBytes)
+{
+    return(0);
+}
+
+unsigned long g_ulTestLiteAddress;
+unsigned long g_ulTestLiteData;
+
+//IPC-Liteд־æʱʧܣ¼ַݲλ״̬־ȵTestMsgRamMap()
+unsigned short IPCLiteMtoCDataWrite(unsigned long ulFlag, unsigned long ulAddress,
+                                    unsigned long ulData, unsigned short usLength,
+                                    unsigned long ulStatusFlag)
+{
+    if(HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) & (ulFlag | ulStatusFlag))
+    {
+        return(STATUS_FAIL);
+    }
+    g_ulTestLiteAddress = ulAddress;
+    g_ulTestLiteData = ulData;
+    HWREG(MTOCIPC_BASE + IPC_O_MTOCIPCFLG) |= ulFlag | ulStatusFlag;
+    return(STATUS_PASS);
+}